@@ -0,0 +1,86 @@
+#! /bin/sh
+
+# Benchmark harness for bf+
+#
+# Usage: bench/bench.sh [-r runs] [-b binary] [-e engines] [-c configs] [program.b ...]
+#
+#   -r  runs per program, engine and configuration (default 5)
+#   -b  interpreter to measure (default ./bf+ next to this directory)
+#   -e  engines: switch, threaded and jit (default all three)
+#   -c  configuration files (default bf+.conf and bench/cell32.conf)
+#
+# Without programs every bench/*.b is run; the input of name.b is name.in
+# when that file exists. The result is one tab separated line per program,
+# configuration and engine on the standard output (progress goes to the
+# standard error):
+#
+#   program config engine runs median_s operations ops_per_s peak_rss_kib
+#   output_bytes checksum status
+#
+# operations is the count of executed operations reported by --profile (the
+# optimized program, the same for every engine). checksum is the FNV-1a hash
+# of the program output; it must not change between engines or commits.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+runs=5
+binary="$dir/../bf+"
+engines="switch threaded jit"
+configs="$dir/../bf+.conf $dir/cell32.conf"
+
+while getopts "r:b:e:c:" option; do
+    case $option in
+    r) runs=$OPTARG ;;
+    b) binary=$OPTARG ;;
+    e) engines=$OPTARG ;;
+    c) configs=$OPTARG ;;
+    *) exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+if [ $# -eq 0 ]; then
+    set -- "$dir"/*.b
+fi
+
+runner="${TMPDIR:-/tmp}/bf+-bench-runner.$$"
+trap 'rm -f "$runner"' EXIT INT TERM
+${CC:-gcc} -std=c89 -Wall -Wextra -pedantic -O2 "$dir/runner.c" -o "$runner" || exit 1
+
+printf "program\tconfig\tengine\truns\tmedian_s\toperations\tops_per_s\tpeak_rss_kib\toutput_bytes\tchecksum\tstatus\n"
+
+for program in "$@"; do
+    input="${program%.b}.in"
+    if [ -f "$input" ]; then
+        set -- -i "$input"
+    else
+        set --
+    fi
+
+    for config in $configs; do
+        operations=$("$binary" -q -P -c "$config" -f "$program" "$@" 2>&1 >/dev/null |
+                     sed -n 's/^Profile: \([0-9]*\) operations.*/\1/p')
+
+        for engine in $engines; do
+            case $engine in
+            jit) engine_option="-j" ;;
+            *) engine_option="-e $engine" ;;
+            esac
+
+            echo "$(basename "$program") $(basename "$config") $engine" >&2
+            if result=$("$runner" "$runs" "$binary" -q -c "$config" -f "$program" "$@" $engine_option); then
+                status=ok
+            else
+                status=failed
+            fi
+
+            echo "$result" | awk -v program="$(basename "$program")" -v config="$(basename "$config")" \
+                                 -v engine="$engine" -v runs="$runs" -v operations="${operations:-0}" \
+                                 -v status="$status" '
+                {
+                    printf "%s\t%s\t%s\t%d\t%.6f\t%s\t%.0f\t%d\t%d\t%s\t%s\n",
+                           program, config, engine, runs, $1, operations,
+                           ($1 > 0) ? operations / $1 : 0, $2, $3, $4, status
+                }'
+        done
+    done
+done
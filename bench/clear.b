@@ -0,0 +1,21 @@
+Cell clear microbenchmark
+
+Three nested counter loops run 600000 times a body that fills eight cells
+with constants and with copies of the counters and clears them all with the
+clear loop idiom; half of the cells are cleared a second time while zero
+Prints a dot sign per outer iteration
+Works with any cell size
+Part of the bfplus benchmark suite
+
+[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++[>[-]++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++[>[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++[>>>+++>++++++++>+++++++++++++>++++++++
+++++++++++>+++++++++++++++++++++++>++++++++++++++++++++++++++++>++++++++++++++
++++++++++++++++++++>++++++++++++++++++++++++++++++++++++++<<<<<<<<<<[->>>>>>>>
+>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>
+>>+<<<<<+<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>
+>>>>>>>+<<<+<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<[-]>
+[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<[-]>>[-]>>[-]>>[-]<<<<<<<<<-]<-]>>>>>>>>>>>>
+++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<<<<-]>>>>>>>>>>>>>
+++++++++++.[-]
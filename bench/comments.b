@@ -0,0 +1,4130 @@
+Comment heavy source
+
+About 370 kilobytes of prose and comments around a program that prints one
+line: measures loading and compiling rather than execution
+Comments use the vertical bar form so use_comment_type1 must be enabled as
+in the default configuration
+Part of the bfplus benchmark suite
+
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+.+++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++.+++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++..+++.----
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+---.++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++.+++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
++++.---.--.-
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+----.+++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++.-
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+----.+++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+++++++++++++
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
++++.+++.+++.
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+-------.----
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+------------
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: the loop [->+<] moves a cell, [-] clears it, and the pointer moves with < and >|
+This file exists to measure how fast the source loader and the compiler skip text that is not code
+|comment: 1 + 1 = 2, 10 * 10 = 100; arrays like a[i] and lists like (a, b, c) are fine here.|
+Every block of prose like this one is ignored character by character because none of its letters is a command
+|comment: nothing in here is executed, not even this, the markers delimit the text|
+The program itself is tiny and is spread out between the comments in short fragments
+|comment: H, Q and 9 are HQ9+ commands outside of comments, inside they are just letters|
+A good interpreter spends almost no time here and a slow one shows it in the load phase
+|comment: Question? Answer! Hash # and star * are comment markers only when enabled|
+------------
+------------
+------------
+------------
+-----.++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++++++.-----
+-------.----
+---.++++++++
++++++++++++.
+------------
+------------
+------------
+------------
+------------
+------------
+------------
+.+++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++.+++++++++
++.----------
+------------
+------------
+------------
+------------
+------------
+------------
+-.++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
++++++++.++.+
++++.+.------
+--.+++++++++
+++++.-------
+------------
+------------
+------------
+------------
+------------
+------------
+----------.+
+++++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++++++++++++
+++++++.+++++
++++++++.--..
+--------.+++
+++++++.+++++
++.-.--------
+------------
+------------
+------------
+------------
+------------
+------------
+--.---------
+------------
+--.[-]
@@ -0,0 +1,188 @@
+Integer factorization by trial division
+
+Reads decimal numbers one per line from the input and prints each number
+followed by its prime factors; a line with 0 ends the input
+The benchmark input is in the file factor dot in next to this one
+Needs cells of at least 32 bits and does not rely on wrap around
+Part of the bfplus benchmark suite
+
+>>>>>>>>[-]+[<<<<<<<<[-]>>>>>>>>>[-]+[<<<<<<<<,---------->>>>>>>>>+<<<<<<<<<[-
+>>>>>>>>>>>+<+<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<[<-<<<<<<<<<---
+-----------------------------------<[->>++++++++++<<]>>[-<<+>>]<[-<+>]>>>>>>>>
+>>[-]]<[<[-]>-]<<<<<<<<<[-]>>>>>>>>]>+<<<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<<<<<]>
+>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<[<->[-]]<[<<[-]>>[-]]<<<<<<<<<<[->>>>>
+>>>>>>+<+<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<[>>>>>>>>>[-]<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>][-]++++++++++>[-]>[-]>[-]
+>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+
+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[-
+>+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<<<<<[-]>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[
+-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>
+>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<
+<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<<<<[-]
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[
+->>>+<<<<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<
+<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>
+>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<
+<<[-]<<<<<<<[-]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<
+<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>
+>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>
++<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<
+]>[-]>[-]<<<<<[-]<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[-<<<<<<<+>
+>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<
+<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[-
+>>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>
+>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<[-]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>[-<<<<<
+<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<
+<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<
+<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>
+]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<[-]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[-<<<<<
+<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<
+<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<
+<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>
+]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<[-]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[-<<<<<<<+>
+>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<
+<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[-
+>>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>
+>]<<<<<<]>[-]>[-]<<<<<[-]<<[-]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<<<<<<+>>>>>>>]<
+<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>]<[-]<<<[-]>[-]>[-]<<<[->>>>>+<+<<<<]>>>>>
+[-<<<<<+>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<++++++++++++++++++++++++++
+++++++++++++++++++++++.>>>>[-]]<<<<[-]<[->>>>>>+<+<<<<<]>>>>>>[-<<<<<<+>>>>>>]
+<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<+++++++++++++++++++++++++++++++++++++++
++++++++++.>>>>>[-]]<<<<<[-]<[->>>>>>>+<+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<[<[-]
++>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<<++++++++++++++++++++++++++++++++++++++++++++
+++++.>>>>>>[-]]<<<<<<[-]<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<[
+-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<<<+++++++++++++++++++++++++++++++++++++++++
++++++++.>>>>>>>[-]]<<<<<<<[-]<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>
+>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<<<<++++++++++++++++++++++++++++++
+++++++++++++++++++.>>>>>>>>[-]]<<<<<<<<[-]<[->>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>>
+[-<<<<<<<<<<+>>>>>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<<<<<+++++++++++
++++++++++++++++++++++++++++++++++++++.>>>>>>>>>[-]]<<<<<<<<<[-]<[->>>>>>>>>>>+
+<+<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<
++>>]<[<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>>>>[-]
+]<<<<<<<<<<[-]>>>>>>>>>+[->>+<+<]>>[-<<+>>]<[<<<<<<<<<<<++++++++++++++++++++++
+++++++++++++++++++++++++++.>>>>>>>>>>>[-]]<<<<<<<<<<<[-]>>>>>>>>>>[-]<<<<<<<<<
+<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<[-]++>>
+>>>>[-]+[<<<<<[-]<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[-<<<
+<<<<<[->>>>>>>>>+<<<<<<<<+<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<]<<<<<<<<<<<[->>>>
+>>>>>>>>>>+<<<+<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<
+<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<[-]>>>>
+>>[-]<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<+>>[-
+]]<[-]]<[<<->->[-]<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<]>>>>[-<<<<+>
+>>>]<[<<+>>[-]]<[-]]<]<<<<<<[-]>>>>>[->>>+<+<<]>>>[-<<<+>>>]<[<<<<<<<+>>>>>>>[
+-]]<<<[-]>[-]<+<<<<[->>>>>>+<+<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[<-<<[-]>>>[-]]<[>[
+-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<+<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<+<<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<<<<<[-
+]>[-]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<+<<<<<<[->>
+>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<-<<<<<<<<<+>>>>>>>>>>[-]]<[>++
+++++++++++++++++++++++++++++++.[-]>>>>>>>>[-]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>
+>>>>>>>>+<<<+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>][-]++++++++++>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>
+>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<
+<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>
+[-]>[-]<<<<<[-]<<<<<<<<<[-]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]>[
+-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]
+>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]
+<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[
++[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<<<<[-]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>][-]>[-]
+>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<
+<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<
+<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<<<[-]>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<+>>>>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<
++>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>
+>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>
+>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<<[-]>>>>>>
+>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]
+>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>
+>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<
+<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<[-
+]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<
+<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<
+<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[
+-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<
+<[-]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<
+<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<
+<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[
+-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<
+[-]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]
+>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>
+>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<
+<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<[-]>>
+>>>>>>[-<<<<<<<<+>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<
++>>>]<[-]<<<[-]>[-]>[-]<<<[->>>>>+<+<<<<]>>>>>[-<<<<<+>>>>>]<[<[-]+>[-]]<[->>+
+<+<]>>[-<<+>>]<[<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>[-]]<
+<<<[-]<[->>>>>>+<+<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]
+<[<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>[-]]<<<<<[-]<[->>
+>>>>>+<+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<
+<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>[-]]<<<<<<[-]<[->>>>>
+>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<
+<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>[-]]<<<<<<<[-]<[-
+>>>>>>>>>+<+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-
+<<+>>]<[<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>>[-]]<
+<<<<<<<[-]<[->>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<[-]+>
+[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++
++++++.>>>>>>>>>[-]]<<<<<<<<<[-]<[->>>>>>>>>>>+<+<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<
+<<<<<+>>>>>>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<<<<<<++++++++++++++++
+++++++++++++++++++++++++++++++++.>>>>>>>>>>[-]]<<<<<<<<<<[-]>>>>>>>>>+[->>+<+<
+]>>[-<<+>>]<[<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>
+>>>>>>[-]]<<<<<<<<<<<[-]>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>[->>>>>>>>
++<<<<<<<<<<<<<+>>>>>]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<-]<<<<<<<[-]>[-]>>>>>-]<<<<[
+-]<<<[-]>>>>>]<<[-]<<<<<<<[->>>>>>>>>>>+<<<<+<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+
+>>>>>>>>>>>]<<<<-[->>>>>+<+<<<<]>>>>>[-<<<<<+>>>>>]<[>++++++++++++++++++++++++
+++++++++.[-]>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<+<<<<<
+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>>>>>>>][-]++++++++++>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<
+<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>
+>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<
+<<[-]<<<<<<<<<[-]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]>[-<<<<<<<+>
+>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<
+<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[-
+>>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>
+>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<<<<[-]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>][-]>[-]>[-]>[-]>[
+-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>
+>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->+>-[>
++>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<<<[-]>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<+>>>>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>][-]>[
+-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>[-<<<<<<
+<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<
+<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<<[-]>>>>>>>>>>>>[-<<
+<<<<<<<<<<+>>>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>
+>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>
+[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>
+>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<<[-]>>>>>>>>>
+>>[-<<<<<<<<<<<+>>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<
+<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>
+>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+
+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<<[-]>>>>>>
+>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<
+<<+>>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>
+>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+
+>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<<[-]>>>>>>>
+>>[-<<<<<<<<<+>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>
+>>][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<[->>>>>>>>>>>+<<<<<<<+<<<<]>>>>>>>>>>>
+[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<+<<<]>>>>>>>>[-<<<<<<<<+>>>>
+>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<[-]<<[-]>>>>>>>>[-<<
+<<<<<<+>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<[-]>[->>>+<<<<+>]>>>[-<<<+>>>]<[-]<
+<<[-]>[-]>[-]<<<[->>>>>+<+<<<<]>>>>>[-<<<<<+>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<
++>>]<[<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>[-]]<<<<[-]<[->
+>>>>>+<+<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<+++
++++++++++++++++++++++++++++++++++++++++++++++.>>>>>[-]]<<<<<[-]<[->>>>>>>+<+<<
+<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<<++++++++
+++++++++++++++++++++++++++++++++++++++++.>>>>>>[-]]<<<<<<[-]<[->>>>>>>>+<+<<<<
+<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<<<+++++
++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>[-]]<<<<<<<[-]<[->>>>>>>>>+
+<+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<
+<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>>[-]]<<<<<<<<[-]
+<[->>>>>>>>>>+<+<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[<[-]+>[-]]<[->>+
+<+<]>>[-<<+>>]<[<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>
+>>>>>[-]]<<<<<<<<<[-]<[->>>>>>>>>>>+<+<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>
+>>>>>>>]<[<[-]+>[-]]<[->>+<+<]>>[-<<+>>]<[<<<<<<<<<<++++++++++++++++++++++++++
+++++++++++++++++++++++.>>>>>>>>>>[-]]<<<<<<<<<<[-]>>>>>>>>>+[->>+<+<]>>[-<<+>>
+]<[<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++.>>>>>>>>>>>[-]]
+<<<<<<<<<<<[-]>>>>>>>>>>[-]<<<<<<<<<<<[-]]<<<<[-]>>>>++++++++++.[-]<[-]]<<]<<<
+<<<<<[-]>>>[-]
@@ -0,0 +1,207 @@
+Mandelbrot set in ASCII art
+
+Renders a 60 by 24 character view of the set: the real axis from minus two
+to one half and the imaginary axis from one to minus one
+Fixed point arithmetic with a scale of 24 on sign and magnitude pairs and
+at most 20 iterations per point
+Needs cells of at least 32 bits and does not rely on wrap around
+Part of the bfplus benchmark suite
+
+>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++<<<<<<<<<<<[-]>[-]++++++++++++++++
+++++++++>>>[-]++++++++++++++++++++++++[<<<<<<[-]+>[-]+++++++++++++++++++++++++
++++++++++++++++++++++++>>>>>>[-]++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++[<<<<<<<<<<<[-]>[-]>[-]>[-]>>>>>[-]>[-]+>>>>>>>>>>>[-]++++++++++
+++++++++++<<<<<<<<<<<[>>>>>[-]<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<
+<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+]<[-<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<][-]>[-]>[-]>[-]>
+[-]>[-]>[-]<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<+<<<<<<<]>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>+<<<<<+<<<<<<]>>>>>>>>>>>[-<<
+<<<<<<<<<+>>>>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<<<<
+<<<[-]>>>[-]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<
+<<<<<<[-]<[-]<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>]<][-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<[->>>>>>>>>>>>>>+
+<<<<<<<+<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<[->>>
+>>>>>>>>+<<<<<+<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<[->+>-[>+>>]
+>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<<<<<<[-]>>[-]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]
+>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<[-]<[-]<<[->>>>>>>>>+<<<<<<<+<<]>>>>>>>
+>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<+<]>>>>>>>>[-<<<<<<<<+>>>>>>
+>>]<<<<<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++[->>>>>>>>>+<<<+<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>
+>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<
+<<<<<[-]>>>>>>>[-]<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<]>>>>[-<<<<+>
+>>>]<[<<+>>[-]]<[-]]<[<<->->[-]<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<
+]>>>>[-<<<<+>>>>]<[<<+>>[-]]<[-]]<]<<<<<<<[-]>>>>>>[->>>+<+<<]>>>[-<<<+>>>]<[<
+<<<<<<<+>>>>>>>>[-]]<<<[-]>[-]<+<<<<<[->>>>>>>+<+<<<<<<]>>>>>>>[-<<<<<<<+>>>>>
+>>]<[<-<<<<<<<<<<<<[-]>>>>>>>>>>>>>[-]]<[<<<<<<<[-]<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>>>>>>>]<[-<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<+<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>]<]<<<<<<<<[->>>>>>>>+<<<<<<<+<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<[->>>>>>>+
+<<<<<<<<+>]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<[-]>>>>>>>[-]>[-]>[-]>[-]>[-]>[-]>[
+-]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<<<<+<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<+<<<<<<<]>>>>>>>>>>>>[-<
+<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]<<<<<
+[-]<<<<[-]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<[-]>
+>>[-]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<+<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<[<<<<<<<[-]+>>>[->>>>>>+<+<<<<<]>>>
+>>>[-<<<<<<+>>>>>>]<[<<<<<<<<->>>>>>>>[-]]<<<<<[-]<<<[->>>>>>>>+<<<<<+<<<]>>>>
+>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<[-]>>>>>>>[-]]+<<<[->>>>>+<+<<<<]>>>>>[-<<<<<+
+>>>>>]<[<->[-]]<[<<<<[-]>>>>[-]]>>>[-]+<<<<<<<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>>
+[-<<<<<<<<<+>>>>>>>>>]<[<->[-]]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<+<
+<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>>>>>]<[>[-]+<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<->[-]]<<<[-]>>[->+<<<+>>]>[-
+<+>]<[-]<[-]]+<[->>>+<+<<]>>>[-<<<+>>>]<[<-<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>
+>>>>>>>[->>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>[-<<<<<
+<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<
+<<<<<<<+>>>>]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[->>>>>>>>>>+<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[-]]<[<<<<<<<[->>
+>>>>>>>>>+<<<+<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<[-]>>>>>[-]<<[->>>>+<
++<<<]>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<+>>[-]]<[-]]<[<<->->
+[-]<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<+>>[-]]
+<[-]]<]<<<<<[-]>>>>[->>>+<+<<]>>>[-<<<+>>>]<[<<<<<<+>>>>>>[-]]<<<[-]>[-]<+<<<[
+->>>>>+<+<<<<]>>>>>[-<<<<<+>>>>>]<[<-<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[->>>>>>>>
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>]>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<->>>>>>>>>>>>>>>>]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[-]>>>>[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>]>
+>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<[-]]<
+[<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[->>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<->>>>]>>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>
+>>>>>>[->>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>[-<<<
+<<<<<<<+>>>>>>>>>>]<-]<<<[-]>>-]<[-]+<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
+>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>]<[<->[-]]<[<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>
+>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<+<<<<<<<<<<]>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+<<+<<<<<<<<<<]>>>>>>>>>>
+>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<[-]>>>>>>>>>[-]<<[->>>>+<+<<<]>>>>[-<<
+<<+>>>>]<[<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<+>>[-]]<[-]]<[<<->->[-]<<[->>>>+<
++<<<]>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<+>>[-]]<[-]]<]<<<<<<
+<<<[-]>>>>>>>>[->>>+<+<<]>>>[-<<<+>>>]<[<<<<<<<<<<+>>>>>>>>>>[-]]<<<[-]>[-]<+<
+<<<<<<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<[<-<<<<[-]+>[-]<<
+<<<<[->>>>>>>>>>>+<<<<<+<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<
+<<[->>>>>>>>>>>>+<<<<<-<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<[-]]<[
+<<<<[-]>[-]<<<<<<<[->>>>>>>>>>>+<<<<+<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>
+>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<-<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<-]<<
+<<<<<[-]>>>>>>>>>>[-]+<<<<<<<[->>>>>>>>>+<+<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>
+>>>>]<[<->[-]]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>]<[>[-]+<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<->[-]]<<<[-]>>[->+<<<+>>]>[-<+>]<
+[-]<[-]]+<[->>>+<+<<]>>>[-<<<+>>>]<[<-<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>
+>>>>>>[->>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>>>>>>>>>[-<<
+<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>>>>]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[->>>>>>>>>>
++<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>
+>>>>]<[-]]<[<<<<<<<[->>>>>>>>>>>+<<<+<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>
+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<+<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>]<<<<<<[-]>>>>>[-]<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<]>>>>[
+-<<<<+>>>>]<[<<+>>[-]]<[-]]<[<<->->[-]<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<[->>>
+>+<+<<<]>>>>[-<<<<+>>>>]<[<<+>>[-]]<[-]]<]<<<<<[-]>>>>[->>>+<+<<]>>>[-<<<+>>>]
+<[<<<<<<+>>>>>>[-]]<<<[-]>[-]<+<<<[->>>>>+<+<<<<]>>>>>[-<<<<<+>>>>>]<[<-<<<<<<
+<<<<<<<<<<<<<<<<<<<<[-]>>>>[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<+>>>>]>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
+>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>
+]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>[->>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>]>>>>>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<[-]]<[<<<<<<<<<<<<<<
+<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[->>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>]>>>>>>>>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>
+>>>>>>>>>>>>>>>[->>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]>>
+>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<-]<<<[-]>>-]<[-]+<<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>]<[<->[-]]<[<<<<<<<<<<
+<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>-
+>>+<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<->[-]]<[<<<<<<<<<<<<<[-]>>>>>>>>>>>>>[-]]
+<-]<<<<<[-]<<[-]>[-]<<<[-]>[-]<<<<]<[->>>>>>>>>>>>>+<<<<<<<+<<<<<<]>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<[-]++++++++++++++++++++++++++++++++<[->>
+>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->++++++++++++++>>>>>>[-
+]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->-->>>>>>[
+-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->>>>>>>[-
+]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->+++++++++
++++++>>>>>>[-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<
+<<->>>>>>>[-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<
+<->+>>>>>>[-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<
+<->>>>>>>[-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<
+->-------------->>>>>>[-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>
+>>>]<[<<<<<<<->>>>>>>[-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>
+>>]<[<<<<<<<->++++++++++++++++>>>>>>[-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-
+<<<<<<<<+>>>>>>>>]<[<<<<<<<->------------------>>>>>>[-]]<<<<<<<[->>>>>>>>+<+<
+<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->>>>>>>[-]]<<<<<<<[->>>>>>>>+<+<<
+<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->->>>>>>[-]]<<<<<<<[->>>>>>>>+<+<<
+<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->>>>>>>[-]]<<<<<<<[->>>>>>>>+<+<<<
+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->----->>>>>>[-]]<<<<<<<[->>>>>>>>+<
++<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->>>>>>>[-]]<<<<<<<[->>>>>>>>+<+
+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->-->>>>>>[-]]<<<<<<<[->>>>>>>>+<
++<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->>>>>>>[-]]<<<<<<<[->>>>>>>>+<+
+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->+++++++++++++++++++++++++++++>>
+>>>>[-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<<<->>>>
+>>>[-]]<<<<<<.[-]<[-]>>>>>>[-]<<[-]>[-]+<<<<<[-]<<<<<<<<<<[->>>>>>>>>>>>>>>>>+
+<<<<<<<+<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>]<<<<
+<<[-]<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<+<<<<<<<<<<]>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>]>>>[-]+<<<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>
+>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<[<->[-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>
+>[-<<<<<<<<+>>>>>>>>]<[>[-]+<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<->[-]]<<<[-]>>[-
+>+<<<+>>]>[-<+>]<[-]<[-]]+<[->>>+<+<<]>>>[-<<<+>>>]<[<-<<<<<<<<<<<<<<<<<<<<[-]
+>>>>>>>>>>[->>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>]>>>>>>>>>>>>[-<<<<<
+<<<<<<<+>>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]
+>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>[->>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>
+>]<[-]]<[<<<<<<<<<<[->>>>>>>>>>>>>>+<<<+<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<+<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+
+>>>>>>>>>>]<<<<<<[-]>>>>>[-]<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<]>>
+>>[-<<<<+>>>>]<[<<+>>[-]]<[-]]<[<<->->[-]<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<[-
+>>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<+>>[-]]<[-]]<]<<<<<[-]>>>>[->>>+<+<<]>>>[-<<<+>
+>>]<[<<<<<<+>>>>>>[-]]<<<[-]>[-]<+<<<[->>>>>+<+<<<<]>>>>>[-<<<<<+>>>>>]<[<-<<<
+<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[->>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<<<<<<->>>>>>>>>>]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[->>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[-]]<[<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>
+>>>[->>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>]>>>>>>>>>>>>[-<<<<<<<<<<<<
++>>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>]>>>>>>>
+>[-<<<<<<<<+>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>[->>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<-]<<
+<[-]>>-]<[-]+<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<[<->[-]]<
+[<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<[-]>[-]>>>>[-]<<<<<<
+<<-]>>>>>>>>>>++++++++++.[-]<<<[-]+>[-]++<<<<<[-]<<<<<<<<[->>>>>>>>>>>>>>>+<<<
+<<<<+<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<[-]<<<<<<
+<<[->>>>>>>>>>>>>>+<<<<<<+<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>]>>>[-]+<<<<<<<<<<[->>>>>>>>>>>>+<+<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>
+>>>>>>>>>>]<[<->[-]]<<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[
+>[-]+<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<->[-]]<<<[-]>>[->+<<<+>>]>[-<+>]<[-]<[-
+]]+<[->>>+<+<<]>>>[-<<<+>>>]<[<-<<<<<<<<<<<<<<<<<<[-]>>>>>>>>[->>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<[-
+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<
+<<<<<<<<<<<<<<[-]>>>>>>>>[->>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>]>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<[-]]<[<<<<<<<<<<[->>>>>>>>>>>>>>+<<<+<<<
+<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+
+<<+<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<[-]>>>>>[-]<<[->>>>+<+<<<]
+>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<+>>[-]]<[-]]<[<<->->[-]<<
+[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<[->>>>+<+<<<]>>>>[-<<<<+>>>>]<[<<+>>[-]]<[-]]
+<]<<<<<[-]>>>>[->>>+<+<<]>>>[-<<<+>>>]<[<<<<<<+>>>>>>[-]]<<<[-]>[-]<+<<<[->>>>
+>+<+<<<<]>>>>>[-<<<<<+>>>>>]<[<-<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[->>>>>>>>>+
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<<<<<<<<
+<[->>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<->>>>>>>>]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[->>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<[-]]<[<<<<<<<<<<<<<<<<
+<<<[-]>>>>>>>>[->>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>]>>>>>>>>>>>>[-<<<<<
+<<<<<<<+>>>>>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>]>>>>
+>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>[->>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<-]<<<[-]>
+>-]<[-]+<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>]<[<->[-]]<[<<<<<<<<<<<<<<<<
+<<[-]>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<[-]>[-]>>>>[-]<[-]<<<<<<<<-]
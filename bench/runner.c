@@ -0,0 +1,214 @@
+/* ************************************************************************** */
+/* Program name: Brainfuck Interpreter Plus (bf+)                             */
+/* Description: Benchmark runner: runs a command several times and reports    */
+/*              the median wall time, the peak RSS and a checksum of the      */
+/*              output                                                        */
+/* Author: Vasiliy V. Bodrov aka Bodro (e-mail: bodro-mail at list.ru)        */
+/* Date: 2014-09-08                                                           */
+/*                                                                            */
+/* Programming language: ISO/IEC 9899:1990 (C90)                              */
+/* Commenting language: English                                               */
+/* ************************************************************************** */
+/* Usage: runner <runs> <program> [arguments...]                              */
+/* Output (one line): <median seconds> <peak RSS KiB> <output bytes>          */
+/*                    <output checksum>                                       */
+/* The standard input of the command is /dev/null, the standard output is     */
+/* read through a pipe and the standard error is discarded. The exit status   */
+/* is not 0 if any run fails.                                                 */
+/* ************************************************************************** */
+/* Functions:                                                                 */
+/*     compare_times                                                          */
+/*     run_once                                                               */
+/*     main                                                                   */
+/* ************************************************************************** */
+/* The MIT License (MIT)                                                      */
+/*                                                                            */
+/* Copyright (c) 2014 IPB Software (Vasiliy V. Bodrov)                        */
+/*                                                                            */
+/* See the file bf+.c for the full license text.                              */
+/* ************************************************************************** */
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define READ_BLOCK_SIZE 65536
+#define FNV_OFFSET_BASIS 2166136261UL
+#define FNV_PRIME 16777619UL
+
+/* Result of one run */
+typedef struct run_result_s {
+    double seconds;         /* wall time                                      */
+    long max_rss;           /* peak resident set size in KiB                  */
+    unsigned long bytes;    /* size of the output                             */
+    unsigned long checksum; /* FNV-1a hash of the output (32 bits)            */
+} run_result_t, *run_result_p;
+
+/* -------------------------------------------------------------------------- */
+/* Function: compare_times                                                    */
+/* Description: orders run times (ascending) for qsort                        */
+/* Parameters: a, b - pointers to the times                                   */
+/* Return: <0, 0, >0                                                          */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int compare_times(const void* a, const void* b) {
+    double x = *(const double*) a;
+    double y = *(const double*) b;
+
+    return (x > y) - (x < y);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: run_once                                                         */
+/* Description: runs the command and waits for it                             */
+/* Parameters: argv - command and its arguments (NULL terminated)             */
+/*             result - time, memory and output of the run (out)              */
+/* Return: 0 - success; -1 - failure (the command did not exit with 0)        */
+/* Note: the wall time includes reading the whole output                      */
+/* -------------------------------------------------------------------------- */
+int run_once(char* const* argv, run_result_p result) {
+    static unsigned char buffer[READ_BLOCK_SIZE];
+    struct timeval start;
+    struct timeval stop;
+    struct rusage usage;
+    int pipe_fds[2];
+    int status = 0;
+    pid_t pid = 0;
+    ssize_t count = 0;
+    ssize_t i = 0;
+    int fd = -1;
+
+    if(pipe(pipe_fds)) {
+        perror("pipe");
+        return -1;
+    }
+
+    (void) gettimeofday(&start, NULL);
+
+    pid = fork();
+    if(pid < 0) {
+        perror("fork");
+        (void) close(pipe_fds[0]);
+        (void) close(pipe_fds[1]);
+        return -1;
+    }
+
+    if(!pid) {
+        fd = open("/dev/null", O_RDWR);
+        if(fd >= 0) {
+            (void) dup2(fd, STDIN_FILENO);
+            (void) dup2(fd, STDERR_FILENO);
+            (void) close(fd);
+        }
+        (void) dup2(pipe_fds[1], STDOUT_FILENO);
+        (void) close(pipe_fds[0]);
+        (void) close(pipe_fds[1]);
+        (void) execvp(argv[0], argv);
+        _exit(127);
+    }
+
+    (void) close(pipe_fds[1]);
+
+    result->bytes = 0;
+    result->checksum = FNV_OFFSET_BASIS;
+    for(;;) {
+        count = read(pipe_fds[0], buffer, sizeof(buffer));
+        if(count < 0 && EINTR == errno) {
+            continue;
+        }
+        if(count <= 0) {
+            break;
+        }
+        for(i = 0; i < count; i++) {
+            result->checksum = ((result->checksum ^ buffer[i]) * FNV_PRIME) & 0xffffffffUL;
+        }
+        result->bytes += (unsigned long) count;
+    }
+    (void) close(pipe_fds[0]);
+
+    while(wait4(pid, &status, 0, &usage) < 0) {
+        if(EINTR != errno) {
+            perror("wait4");
+            return -1;
+        }
+    }
+
+    (void) gettimeofday(&stop, NULL);
+
+    result->seconds = (double) (stop.tv_sec - start.tv_sec) +
+                      (double) (stop.tv_usec - start.tv_usec) / 1e6;
+    result->max_rss = usage.ru_maxrss;
+
+    return (WIFEXITED(status) && !WEXITSTATUS(status)) ? 0 : -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: main                                                             */
+/* Description: entry point                                                   */
+/* Parameters: argc - count of arguments                                      */
+/*             argv - arguments: runs, command and its arguments              */
+/* Return: EXIT_SUCCESS or EXIT_FAILURE                                       */
+/* Note: the output size and checksum must be the same in all runs            */
+/* -------------------------------------------------------------------------- */
+int main(int argc, char** argv) {
+    run_result_t result;
+    run_result_t first;
+    double* times = NULL;
+    long max_rss = 0;
+    int runs = 0;
+    int failed = 0;
+    int i = 0;
+
+    if(argc < 3 || (runs = atoi(argv[1])) <= 0) {
+        (void) fprintf(stderr, "Usage: %s <runs> <program> [arguments...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    times = (double*) malloc((size_t) runs * sizeof(double));
+    if(!times) {
+        perror("Memory error");
+        return EXIT_FAILURE;
+    }
+
+    (void) memset(&first, 0, sizeof(first));
+    for(i = 0; i < runs; i++) {
+        if(run_once(argv + 2, &result)) {
+            failed = 1;
+        }
+        if(!i) {
+            first = result;
+        }
+        else if(result.bytes != first.bytes || result.checksum != first.checksum) {
+            (void) fprintf(stderr, "%s: output differs between runs\n", argv[2]);
+            failed = 1;
+        }
+        times[i] = result.seconds;
+        if(result.max_rss > max_rss) {
+            max_rss = result.max_rss;
+        }
+    }
+
+    qsort(times, (size_t) runs, sizeof(double), compare_times);
+
+    (void) printf("%.6f %ld %lu %08lx\n",
+                  (runs % 2) ? times[runs / 2] : (times[runs / 2 - 1] + times[runs / 2]) / 2,
+                  max_rss, first.bytes, first.checksum);
+
+    free(times);
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* ************************************************************************** */
+/* End of file                                                                */
+/* ************************************************************************** */
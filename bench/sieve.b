@@ -0,0 +1,95 @@
+Sieve of Eratosthenes
+
+Finds the primes up to 151 with a sieve kept in records of 13 cells that
+are walked along the tape and repeats the whole sieve 1000 times printing
+one line of primes per pass
+Fits in the default tape of 2048 cells
+Needs cells of at least 16 bits and does not rely on wrap around
+Part of the bfplus benchmark suite
+
+>+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>>>>>>>>>+
+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>
+>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>
+>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>
+>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>
+>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>
+>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>
+>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+
+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>
+>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>
+>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>
+>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>
+>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>
+>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>
+>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+
+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>
+>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>
+>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>
+>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>
+>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>
+>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>
+>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+
+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>
+>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>
+>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>
+>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>
+>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>
+>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>[>[-]+>>
+>>>>>>>>>>]<<<<<<<<<<<<<[<<<<<<<<<<<<<]>>+>>>+++++++++>++++++++++>++++++++++<<
+<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>[->>>>>>>>>
+>>>>+<<<<<<<<<<<<<]>[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>[>>+>>>->>>+<<<[->>>>>
++<+<<<<]>>>>>[-<<<<<+>>>>>]<[<->[-]]<[<<<++++++++++>->>>+<<<[->>>>>+<+<<<<]>>>
+>>[-<<<<<+>>>>>]<[<->[-]]<[<<<++++++++++>->>[-]]<[-]]<<<<<<<[->>>>>>>>+<+<<<<<
+<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[>[-]++++++++++<<[->>>+<-<<]>>>[-<<<+>>>]<[->>
++<+<]>>[-<<+>>]<[>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<
+<<[->>>>>+<-<<<<]>>>>>[-<<<<<+>>>>>]<.[-]<[-]]<[-]++++++++++++++++++++<<[->>>+
+<-<<]>>>[-<<<+>>>]<<<<[->>>>+<-<<<]>>>>[-<<<<+>>>>]<[->>+<+<]>>[-<<+>>]<[>++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<<<[->>>>>>+<-<<<<<]>>
+>>>>[-<<<<<<+>>>>>>]<.[-]<[-]]<[-]++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++<<<<[->>>>>+<-<<<<]>>>>>[-<<<<<+>>>>>]<.[-]+++++++++++++++++++++
++++++++++++.[-]<<<<<<<[->>>>>>>+<<<<<<+>+<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<[->
+>>>>>>>>>>>>+<<<<<<<<<<<<<]>[->>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<[-]>>>>>>>>>>>>>
+[>>>->>>>>>+<<<<<<[->>>>>>>>+<+<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<->[-]]<[
+<<<<<<<<[-]>>>[->>>>>>+<<<<<<<+>]>>>>>>[-<<<<<<+>>>>>>]<[-]]<<<<<<[->>>>>>>>>>
+>>>+<<<<<<<<<<<<<]>[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>]>>>[-]>[-]<<<<<<<<<
+<<<<<<<<[<<<<<<<<<<<<<]+>>>>>>>>[-]]<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>[->
+>>>>>>>>>>>>+<<<<<<<<<<<<<]>[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>[->>>>>>>>>>>>>+<<<
+<<<<<<<<<<]>>>>>>]>>[-]>>>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<[<<<<<<<<<<<<<]>>>>>>
+>>++++++++++.[-]<<<<<<<-]
@@ -16,10 +16,116 @@
 /*     print_author                                                           */
 /*     print_version                                                          */
 /*     print_show_information                                                 */
-/*     read_config                                                            */
-/*     is_command                                                             */
+/*     default_options                                                        */
+/*     set_option                                                             */
+/*     read_config_file                                                       */
+/*     load_source                                                            */
+/*     emit_instruction                                                       */
+/*     emit_data                                                              */
+/*     compile_program                                                        */
+/*     optimize_loop                                                          */
+/*     optimize_program                                                       */
+/*     known_reset                                                            */
+/*     known_get                                                              */
+/*     known_set                                                              */
+/*     known_wrap                                                             */
+/*     known_apply                                                            */
+/*     optimize_procedures                                                    */
+/*     optimize_offsets                                                       */
+/*     evaluate_run                                                           */
+/*     evaluate_prefix                                                        */
+/*     tape_range_use                                                         */
+/*     tape_range_close                                                       */
+/*     insert_tape_checks                                                     */
+/*     destroy_program                                                        */
+/*     select_cell_engine                                                     */
+/*     create_tape                                                            */
+/*     destroy_tape                                                           */
+/*     clear_tape                                                             */
+/*     sparse_page                                                            */
+/*     tape_fault_handler                                                     */
+/*     init_context                                                           */
+/*     output_send                                                            */
+/*     output_open                                                            */
+/*     output_flush                                                           */
+/*     output_write                                                           */
+/*     output_close                                                           */
+/*     data_output                                                            */
+/*     input_open                                                             */
+/*     input_fill                                                             */
+/*     input_close                                                            */
+/*     signal_handler                                                         */
+/*     data_input                                                             */
+/*     print_trace_legend                                                     */
+/*     print_trace_event                                                      */
+/*     trace_open                                                             */
+/*     trace_offset                                                           */
+/*     trace_record                                                           */
+/*     trace_dump                                                             */
+/*     trace_close                                                            */
+/*     decode_trace                                                           */
+/*     profile_open                                                           */
+/*     compare_loop_profiles                                                  */
+/*     compare_profile_counts                                                 */
+/*     print_profile                                                          */
+/*     profile_close                                                          */
+/*     data_write                                                             */
+/*     tape_error                                                             */
+/*     procedure_open                                                         */
+/*     procedure_define                                                       */
+/*     procedure_call                                                         */
+/*     procedure_close                                                        */
+/*     checkpoint_page                                                        */
+/*     checkpoint_reset                                                       */
+/*     checkpoint_touch                                                       */
+/*     checkpoint_put                                                         */
+/*     checkpoint_put_page                                                    */
+/*     checkpoint_write                                                       */
+/*     checkpoint_tick                                                        */
+/*     checkpoint_apply                                                       */
+/*     checkpoint_load                                                        */
+/*     checkpoint_open                                                        */
+/*     checkpoint_close                                                       */
+/*     limit_open                                                             */
+/*     limit_alarm                                                            */
+/*     limit_reached                                                          */
+/*     limit_close                                                            */
+/*     jit_data_write                                                         */
+/*     jit_tape_error                                                         */
+/*     jit_limit_reached                                                      */
+/*     jit_emit                                                               */
+/*     jit_store_value                                                        */
+/*     jit_emit_value                                                         */
+/*     jit_emit_cell                                                          */
+/*     jit_compile                                                            */
+/*     run_program_jit                                                        */
+/*     execute_program                                                        */
+/*     vm_read                                                                */
+/*     vm_write                                                               */
+/*     bfplus_create_options                                                  */
+/*     bfplus_set_option                                                      */
+/*     bfplus_read_config                                                     */
+/*     bfplus_destroy_options                                                 */
+/*     bfplus_compile                                                         */
+/*     bfplus_compile_file                                                    */
+/*     bfplus_destroy_program                                                 */
+/*     bfplus_create_vm                                                       */
+/*     bfplus_set_callbacks                                                   */
+/*     bfplus_set_buffers                                                     */
+/*     bfplus_set_files                                                       */
+/*     bfplus_run                                                             */
+/*     bfplus_output_size                                                     */
+/*     bfplus_destroy_vm                                                      */
+/*     emit_c_program                                                         */
+/*     emit_c                                                                 */
 /*     control                                                                */
 /*     work                                                                   */
+/*     batch_clock                                                            */
+/*     batch_parse                                                            */
+/*     batch_find_program                                                     */
+/*     batch_next_job                                                         */
+/*     batch_run_jobs                                                         */
+/*     batch                                                                  */
 /*     main                                                                   */
 /* ************************************************************************** */
 /* The MIT License (MIT)                                                      */
@@ -52,12 +158,37 @@
 /* ************************************************************************** */
 /* INCLUDES                                                                   */
 /* ************************************************************************** */
+#if !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE /* POSIX and BSD extensions (mmap, MAP_ANONYMOUS) */
+#endif /* !defined(_DEFAULT_SOURCE) */
+
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <getopt.h>
 #include <errno.h>
 #include <ctype.h>
+#include <stddef.h>
+#include <limits.h>
+#include <time.h>
+#include <signal.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <pthread.h>
+#endif /* defined(__unix__) || defined(__APPLE__) */
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif /* defined(__SSE2__) */
+
+#include "bfplus.h"
 
 /* ************************************************************************** */
 /* DEFINITIONS */
@@ -95,13 +226,130 @@ IN THE SOFTWARE.\n"
 
 #define MAX_FILE_NAME_LENGTH                 2048
 #define STATIC_CELL_COUNT                    2048
+#define STATIC_LOOP_COUNT                    1024
+#define SOURCE_READ_BLOCK_SIZE               65536
+#define MULADD_MAX_TARGETS                   16
+#define LOOP_GUARD                           1
+#define PROCEDURE_COUNT                      4096
+#define CALL_STACK_SIZE                      4096
+#define PROCEDURE_INLINE_SIZE                16
+#define KNOWN_CELL_COUNT                     32
+#define EVALUATE_STEP_BUDGET                 1048576
+#define EVALUATE_OUTPUT_LIMIT                1048576
+#define SCAN_BLOCK_SIZE                      16
+
+#define OPCODE_SYMBOLS                       " +>.,[]=*S$\"()::!?"
+#define PROFILE_REPORT_SIZE                  20
+
+#define ENGINE_NAME_SWITCH                   "switch"
+#define ENGINE_NAME_THREADED                 "threaded"
+#define ENGINE_NAME_JIT                      "jit"
+
+#define DEFAULT_CELL_SIZE                    64
+#define OUTPUT_BUFFER_SIZE                   65536
+#define OUTPUT_LINE_SIZE                     128
+
+/* Program output goes to the standard output descriptor in large chunks */
+#if defined(__unix__) || defined(__APPLE__)
+#define USE_WRITEV
+#endif /* defined(__unix__) || defined(__APPLE__) */
+
+/* Program input (mapped regular files, block reads), trace files, signals */
+#if defined(__unix__) || defined(__APPLE__)
+#define USE_POSIX_IO
+#endif /* defined(__unix__) || defined(__APPLE__) */
+
+#define INPUT_BLOCK_SIZE                     65536
+
+#define TRACE_EVENT_COUNT                    65536
+#define TRACE_MAGIC                          "BF+T"
+#define TRACE_VERSION                        1
+
+/* Compiled programs cached on disk (cache_directory); CACHE_VERSION must     */
+/* change with the instruction set or the optimizer                           */
+#define CACHE_MAGIC                          "BF+CACHE"
+#define CACHE_VERSION                        6
+#define CACHE_SUFFIX                         ".bfc"
+#define CACHE_HASH_BASIS                     2166136261UL
+#define CACHE_HASH_PRIME                     16777619UL
+
+/* Snapshots of a run (--checkpoint-every, --resume); CHECKPOINT_VERSION      */
+/* must change with the layout of the records                                 */
+#define CHECKPOINT_MAGIC                     "BF+SNAP"
+#define CHECKPOINT_VERSION                   1
+#define CHECKPOINT_SUFFIX                    ".snapshot"
+#define CHECKPOINT_CLOCK_STEPS               65536
+
+/* Exit status of a run stopped by --max-steps, --max-time or --max-output */
+#define LIMIT_EXIT_STATUS                    3
+#define MAX_TIME_LIMIT                       1000000
+
+#define EOF_NAME_MINUS_ONE                   "-1"
+#define EOF_NAME_ZERO                        "0"
+#define EOF_NAME_UNCHANGED                   "unchanged"
+
+/* Names of the functions specialized for one cell type (bf+_engine.h) */
+#define ENGINE_FUNCTION_CONCAT(name, suffix) name##_##suffix
+#define ENGINE_FUNCTION_NAME(name, suffix)   ENGINE_FUNCTION_CONCAT(name, suffix)
+#define ENGINE_FUNCTION(name)                ENGINE_FUNCTION_NAME(name, ENGINE_SUFFIX)
+
+/* Direct threading needs labels as values (GNU C) */
+#if defined(__GNUC__) && !defined(__STRICT_ANSI__)
+#define USE_COMPUTED_GOTO
+#endif /* defined(__GNUC__) && !defined(__STRICT_ANSI__) */
+
+/* Native code generation: x86-64 with POSIX executable mappings */
+#if defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+#define USE_JIT
+#endif /* defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__)) */
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif /* !defined(MAP_ANONYMOUS) && defined(MAP_ANON) */
+
+#define JIT_INITIAL_CODE_SIZE                4096
+
+/* Infinite cells: address range reserved up front and grown on faults */
+#if (defined(__unix__) || defined(__APPLE__)) && defined(MAP_ANONYMOUS) && defined(SA_SIGINFO)
+#define USE_GUARDED_TAPE
+#endif /* (defined(__unix__) || defined(__APPLE__)) && ... */
+
+#if ULONG_MAX > 0xFFFFFFFFUL
+#define GUARDED_TAPE_RESERVE_SIZE            (1UL << 36)
+#else
+#define GUARDED_TAPE_RESERVE_SIZE            (1UL << 28)
+#endif /* ULONG_MAX > 0xFFFFFFFFUL */
+#define GUARDED_TAPE_INITIAL_SIZE            65536
+
+/* Sparse cells: pages allocated on first use, found through a hash directory */
+#define SPARSE_PAGE_BITS                     12
+#define SPARSE_PAGE_CELLS                    (1UL << SPARSE_PAGE_BITS)
+#define SPARSE_DIRECTORY_SIZE                64
+
+/* Batch jobs on a pool of POSIX threads (--jobs) */
+#if defined(__unix__) || defined(__APPLE__)
+#define USE_THREADS
+#endif /* defined(__unix__) || defined(__APPLE__) */
+
+#define MAX_JOB_COUNT                        64
+#define GUARDED_TAPE_SLOTS                   MAX_JOB_COUNT
+
+#if defined(USE_THREADS)
+#define BATCH_LOCK(worker)                   (void) pthread_mutex_lock(&(worker)->lock)
+#define BATCH_UNLOCK(worker)                 (void) pthread_mutex_unlock(&(worker)->lock)
+#else
+#define BATCH_LOCK(worker)
+#define BATCH_UNLOCK(worker)
+#endif /* defined(USE_THREADS) */
 
 #define PARAM_NAME_USE_COMMENT_TYPE1         "use_comment_type1"
 #define PARAM_NAME_USE_COMMENT_TYPE2         "use_comment_type2"
 #define PARAM_NAME_USE_COMMENT_TYPE3         "use_comment_type3"
 #define PARAM_NAME_USE_COMMENT_TYPE4         "use_comment_type4"
 #define PARAM_NAME_USE_INFINITE_CELLS        "use_infinite_cells"
+#define PARAM_NAME_USE_SPARSE_CELLS          "use_sparse_cells"
 #define PARAM_NAME_USE_INFINITE_NESTED_LOOPS "use_infinite_nested_loops"
+#define PARAM_NAME_USE_SAFE_TAPE             "use_safe_tape"
 #define PARAM_NAME_USE_NEGATIVE_VALUE        "use_negative_value"
 #define PARAM_NAME_USE_LARGE_CELL_SIZE       "use_large_cell_size"
 #define PARAM_NAME_USE_FAST_INPUT            "use_fast_input"
@@ -111,6 +359,13 @@ IN THE SOFTWARE.\n"
 #define PARAM_NAME_USE_SYNTAX_HQ9PLUS        "use_syntax_hq9plus"
 #define PARAM_NAME_USE_MOD255                "use_mod255"
 #define PARAM_NAME_USE_FORCE_RN              "use_force_rn"
+#define PARAM_NAME_CELL_SIZE                 "cell_size"
+#define PARAM_NAME_OUTPUT_BUFFER_SIZE        "output_buffer_size"
+#define PARAM_NAME_EOF_VALUE                 "eof_value"
+#define PARAM_NAME_TRACE_EVENTS              "trace_events"
+#define PARAM_NAME_TRACE_SAMPLE              "trace_sample"
+#define PARAM_NAME_CACHE_DIRECTORY           "cache_directory"
+#define PARAM_NAME_ENGINE                    "engine" /* library only */
 
 /* ************************************************************************** */
 /* USER TYPES */
@@ -120,6 +375,13 @@ IN THE SOFTWARE.\n"
 struct program_options_s {
     char config_filename[MAX_FILE_NAME_LENGTH];
     char source_filename[MAX_FILE_NAME_LENGTH];
+    char emit_c_filename[MAX_FILE_NAME_LENGTH];
+    char input_filename[MAX_FILE_NAME_LENGTH];
+    char output_filename[MAX_FILE_NAME_LENGTH];
+    char batch_filename[MAX_FILE_NAME_LENGTH];
+    char trace_filename[MAX_FILE_NAME_LENGTH];
+    char decode_trace_filename[MAX_FILE_NAME_LENGTH];
+    char cache_directory[MAX_FILE_NAME_LENGTH]; /* "" - no program cache  */
     unsigned char verbose;
     unsigned char show_info;
     unsigned char quiet_exit;
@@ -128,6 +390,10 @@ struct program_options_s {
     unsigned char print_help;
     unsigned char print_version;
     unsigned char print_author;
+    unsigned char engine;
+    unsigned char jit;
+    unsigned char profile;
+    unsigned int jobs;                /* threads of the batch mode        */
 
 	union {
         struct comment_flag_s {
@@ -140,16 +406,50 @@ struct program_options_s {
     } comment;
 
     unsigned char use_infinite_cells;
+    unsigned char use_sparse_cells;
     unsigned char use_infinite_nested_loops;
+    unsigned char use_safe_tape;
     unsigned char use_negative_value;
     unsigned char use_large_cell_size;
     unsigned char use_fast_input;
-    unsigned char use_procedure; /* not support (next version) */
+    unsigned char use_procedure; /* pbrain procedures: '(', ')', ':' */
     unsigned char use_symbol_equal;
     unsigned char use_symbol_under;
     unsigned char use_syntax_hq9plus;
     unsigned char use_mod255;
     unsigned char use_force_rn;
+    unsigned int cell_size; /* bits of a cell if use_large_cell_size     */
+    unsigned long output_buffer_size; /* flush threshold (0 - unbuffered) */
+    unsigned char eof_value;          /* cell after ',' at end of input   */
+    unsigned long trace_events;       /* size of the trace ring buffer    */
+    unsigned long trace_sample;       /* record 1 in trace_sample ops     */
+    long max_steps;                   /* 0 - no limits (same below)       */
+    long max_time;                    /* milliseconds                     */
+    unsigned long max_output;         /* bytes                            */
+    long checkpoint_interval;         /* 0 - no snapshots                 */
+    unsigned char checkpoint_seconds; /* the interval is in seconds       */
+    char resume_filename[MAX_FILE_NAME_LENGTH]; /* "" - start anew        */
+};
+
+/* Execution engines */
+enum engines {
+    switch_engine,    /* switch over the instructions (default)         */
+    threaded_engine   /* direct threading (switch without GNU C)        */
+};
+
+/* Cell value after ',' at the end of input */
+enum eof_values {
+    minus_one_eof,    /* cell = -1 (EOF, default)                       */
+    zero_eof,         /* cell = 0                                       */
+    unchanged_eof     /* cell keeps its value                           */
+};
+
+/* Limits of a run (--max-steps, --max-time, --max-output) */
+enum limits {
+    no_limit,
+    step_limit,
+    time_limit,
+    output_limit
 };
 
 /* Modes of interpretation */
@@ -166,81 +466,460 @@ struct loop_position_s {
     fpos_t end_pos;
 };
 
+/* Operation codes of the compiled program */
+enum opcodes {
+    end_op,                   /* End of program                                  */
+    cell_add_op,              /* run of '+' and '-' (cell[offset] += arg)        */
+    cell_move_op,             /* run of '>' and '<' (current cell += arg)        */
+    data_output_op,           /* '.' (writes cell[offset])                       */
+    data_input_op,            /* ',' (reads into cell[offset])                   */
+    loop_begin_op,            /* '[' (jump to the matching ']' if cell is zero;  */
+                              /* arg LOOP_GUARD: the body of a rewritten loop,   */
+                              /* run once if the cell is not zero)               */
+    loop_end_op,              /* ']' (jump to the matching '[' if cell non-zero) */
+    cell_clear_op,            /* '[-]' or '=' (cell[offset] = 0)                 */
+    cell_muladd_op,           /* cell[offset] += cell * arg                      */
+    cell_scan_op,             /* '[>]', '[<]', ... (current cell += arg until 0) */
+    cell_set_op,              /* cell[offset] = arg (evaluated tape)             */
+    data_write_op,            /* arg bytes of data at offset (constant output:   */
+                              /* HQ9+ 'H', 'Q', '9' and the evaluated output)    */
+    procedure_begin_op,       /* '(' (define procedure cell, skip to ')')        */
+    procedure_end_op,         /* ')' (return from the procedure)                 */
+    procedure_call_op,        /* ':' (call procedure cell)                       */
+    procedure_direct_call_op, /* ':' resolved by the optimizer (jump = its '(')  */
+    cell_check_op,            /* cells offset..arg are on the tape (safe tape)   */
+    loop_check_op             /* as cell_check_op if the cell is not zero (the   */
+                              /* next '[' returns to its cell: one check for     */
+                              /* all the iterations)                             */
+};
+
 typedef struct program_options_s program_options_t, *program_options_p;
 typedef struct loop_position_s loop_position_t, *loop_position_p;
-typedef enum modes mode_t;
+typedef enum engines engine_t;
+typedef enum eof_values eof_value_t;
+typedef enum limits limit_t;
+typedef enum modes work_mode_t;
+typedef enum opcodes opcode_t;
 typedef signed long int cell_t, *cell_p;
 typedef signed int code_t, *code_p;
 typedef signed int index_t, *index_p;
 
-/* Main data struct aka class */
-struct main_data_s {
-    union main_data_cells_u {
-        struct final_cells_s {
-            cell_p cells;
-            cell_p current_cell;
-        }* final_cells;
-
-        struct infinite_cells_s {
-            struct infinite_cells_list_s {
-                cell_p cell;
-                struct infinite_cells_s* next_cell;
-            }* current_cell;
-            struct infinite_cells_list_s* start_cells;
-        }* infinite_cells;
-    }* cells;
-
-    union main_data_loops_u {
-        struct final_loops_s {
-            loop_position_p position;
-        }* final_loops;
-
-        struct infinite_loops_s {
-            loop_position_p loop_position;
-            struct infinite_loops_s* next;
-        }* infinite_loops;
-    }* loops;
-/*
-    cell_p cells = NULL;
-    cell_p current_cell = NULL;
-    index_t current_index = 0;
-    loop_position_t loops_pos[1024];
-    int loops_pos_index = -1;
-    */
-    void (*cell_add)(struct main_data_s*);
-    void (*cell_sub)(struct main_data_s*);
-    void (*cell_prev)(struct main_data_s*);
-    void (*cell_next)(struct main_data_s*);
-    void (*data_input)(struct main_data_s*);
-    void (*data_output)(struct main_data_s*);
-    void (*loop_begin)(struct main_data_s*, FILE*);
-    void (*loop_end)(struct main_data_s*, FILE*);
-    void (*hq9plus_h_output)(void);
-    void (*hq9plus_q_output)(FILE*);
-    void (*hq9plus_9_output)(void);
-    void (*done)(void);
+/* Instruction of the compiled program */
+struct instruction_s {
+    opcode_t op;
+    index_t jump; /* matching bracket or parenthesis; '(' of a direct call */
+    long arg;     /* folded operand or size, factor (muladd), last cell    */
+                  /* (checks), LOOP_GUARD (loops)                          */
+    long offset;  /* cell used, relative to the current cell (cell ops,    */
+                  /* I/O, checks); start of the data (data_write)          */
+};
+
+typedef struct instruction_s instruction_t, *instruction_p;
+
+/* Position of an instruction in the source */
+struct source_position_s {
+    long line;
+    long column;
+};
+
+typedef struct source_position_s source_position_t, *source_position_p;
+
+/* Compiled program (comments and non-commands stripped) */
+struct program_s {
+    instruction_p code;
+    index_t size;
+    index_t capacity;
+    unsigned char* data; /* constant output of data_write_op (or NULL) */
+    long data_size;
+    long data_capacity;
+    source_position_p positions; /* per instruction (--profile) or NULL */
+    void* cache;       /* mapped cache file holding the arrays (or NULL) */
+    size_t cache_size;
+};
+
+typedef struct program_s program_t, *program_p;
+
+/* Cells of known value while the optimizer follows straight-line code        */
+struct known_cells_s {
+    long offsets[KNOWN_CELL_COUNT];  /* relative to the first current cell  */
+    long values[KNOWN_CELL_COUNT];
+    unsigned char is_known[KNOWN_CELL_COUNT];
+    int count;
+    long pointer;                    /* current cell (relative)             */
+    unsigned char is_zero;           /* cells not listed are zero           */
+};
+
+typedef struct known_cells_s known_cells_t, *known_cells_p;
+
+/* State of the program run at compile time (evaluate_prefix)                 */
+struct evaluation_s {
+    long cells[STATIC_CELL_COUNT];
+    long pointer;
+    unsigned char* output;           /* EVALUATE_OUTPUT_LIMIT bytes          */
+    long output_size;
+    long steps;
+    index_t pc;                      /* instruction that stopped the run     */
+    index_t resume;                  /* last instruction outside loops       */
+    long resume_steps;               /* steps and output before resume       */
+    long resume_output;
+};
+
+typedef struct evaluation_s evaluation_t, *evaluation_p;
+
+/* Cells used by a part of the program relative to its first cell (safe tape) */
+struct tape_range_s {
+    index_t check;                   /* slot of its check                   */
+    long pointer;                    /* current cell (relative)             */
+    long lo;                         /* lowest and highest cell used        */
+    long hi;
+    long base;                       /* first cell on the tape (absolute)   */
+    unsigned char is_absolute;       /* base is known                       */
+    unsigned char is_used;           /* lo and hi are set                   */
+};
+
+typedef struct tape_range_s tape_range_t, *tape_range_p;
+
+/* Options that change the compiled program (part of the cache key) */
+struct cache_key_s {
+    unsigned long comment;
+    unsigned long flags;     /* use_* options and --profile (one bit each)  */
+    unsigned long cell_size; /* bits                                        */
+    unsigned long eof_value;
+};
+
+/* Header of a cache file (followed by the instructions, the positions and   */
+/* the data)                                                                  */
+struct cache_header_s {
+    char magic[8];
+    unsigned long version;
+    unsigned long layout;        /* sizes of long, instruction and position */
+    unsigned long source_hash;   /* FNV-1a of the source text               */
+    unsigned long source_check;  /* second hash of the source text          */
+    unsigned long source_size;
+    struct cache_key_s key;
+    unsigned long code_size;     /* instructions                            */
+    unsigned long position_count;/* 0 or code_size                          */
+    unsigned long data_size;     /* constant output                         */
+    unsigned long checksum;      /* FNV-1a of everything after the header   */
+};
+
+typedef struct cache_key_s cache_key_t, *cache_key_p;
+typedef struct cache_header_s cache_header_t, *cache_header_p;
+
+/* Instruction prepared for the threaded engine */
+struct threaded_instruction_s {
+    const void* handler;                  /* label of the handler (GNU C)   */
+    opcode_t op;
+    long arg;
+    long offset;
+    struct threaded_instruction_s* jump;  /* instruction after the bracket  */
+};
+
+typedef struct threaded_instruction_s threaded_instruction_t, *threaded_instruction_p;
+
+/* Functions called from the native code (pointer kept in r12) */
+struct jit_callbacks_s {
+    void (*data_output)(const struct jit_callbacks_s* callbacks, void* cell);
+    int (*data_input)(const struct jit_callbacks_s* callbacks, void* cell);
+    void* (*scan)(void* cell, long stride);
+    void (*data_write)(const struct jit_callbacks_s* callbacks, long pc);
+    void (*tape_error)(const struct jit_callbacks_s* callbacks, long pc, long cell);
+    void (*limit_reached)(const struct jit_callbacks_s* callbacks, long pc);
+    long steps;                   /* step budget left (changed by the code) */
+    const struct program_s* program;
+    struct context_s* context;
+};
+
+/* Native code under construction */
+struct jit_buffer_s {
+    unsigned char* code;
+    size_t size;
+    size_t capacity;
+};
+
+typedef struct jit_callbacks_s jit_callbacks_t, *jit_callbacks_p;
+typedef struct jit_buffer_s jit_buffer_t, *jit_buffer_p;
+typedef void (*jit_entry_t)(void* cells, const jit_callbacks_t* callbacks);
+
+/* Tape of cells */
+struct tape_s {
+    void* cells;             /* cell 0                                     */
+    unsigned char* reserve;  /* reserved address range (infinite cells)    */
+    size_t reserve_size;
+    unsigned char* begin;    /* accessible part of the reserved range      */
+    unsigned char* end;
+    size_t page_size;
+    size_t cell_size;
+    void** pages;            /* directory of the sparse tape (or NULL)     */
+    unsigned long* numbers;  /* page number of each used directory entry   */
+    size_t directory_size;   /* entries (a power of two)                   */
+    size_t page_count;
+    unsigned long last_number; /* page found last (one-entry cache)        */
+    void* last_page;           /* NULL - none                              */
+    unsigned char* dirty;      /* page found since the last snapshot (or   */
+                               /* NULL - no snapshots)                     */
+};
+
+typedef struct tape_s tape_t, *tape_p;
+
+/* Buffer of the program output */
+struct output_buffer_s {
+    unsigned char* data;
+    size_t size;
+    size_t capacity;
+    size_t threshold;        /* flush at this size (0 - after each write)  */
+    int fd;                  /* descriptor of the output (writev)          */
+    unsigned char is_open;   /* fd was opened for --output                 */
+    unsigned char is_failed; /* a write failed (the rest is discarded)     */
+};
+
+typedef struct output_buffer_s output_buffer_t, *output_buffer_p;
+
+/* Buffer of the program input */
+struct input_buffer_s {
+    const unsigned char* data;  /* mapped file or block of data            */
+    size_t size;
+    size_t position;
+    unsigned char* block;       /* buffer of block reads (not mapped)      */
+    void* mapping;
+    size_t mapping_size;
+    int fd;
+    unsigned char is_open;      /* fd was opened for --input               */
+    unsigned char is_eof;
+#if defined(USE_POSIX_IO)
+    unsigned char restore_terminal;
+    struct termios terminal;    /* terminal mode before use_fast_input     */
+#endif /* defined(USE_POSIX_IO) */
+};
+
+typedef struct input_buffer_s input_buffer_t, *input_buffer_p;
+
+/* Event of the execution trace */
+struct trace_event_s {
+    long cell;               /* index of the cell used by the instruction  */
+    long value;              /* value of that cell                         */
+    long arg;                /* operand of the instruction                 */
+    index_t pc;
+    unsigned char op;
+};
+
+/* Header of a trace file (followed by the events, oldest first) */
+struct trace_header_s {
+    char magic[4];
+    unsigned long version;
+    unsigned long event_size;
+    unsigned long count;     /* events in the file                         */
+    unsigned long recorded;  /* events recorded (overwritten included)     */
+    unsigned long sample;
+};
+
+/* Ring buffer of the execution trace */
+struct trace_buffer_s {
+    struct trace_event_s* events;
+    unsigned long capacity;
+    unsigned long recorded;
+    unsigned long sample;
+    unsigned long countdown; /* operations until the next recorded one     */
+};
+
+/* Profile of a loop */
+struct loop_profile_s {
+    index_t begin;           /* index of the loop_begin_op                 */
+    unsigned long iterations;
+    unsigned long self;      /* operations outside the nested loops        */
+    unsigned long total;     /* operations including the nested loops      */
+};
+
+typedef struct loop_profile_s loop_profile_t, *loop_profile_p;
+typedef struct trace_event_s trace_event_t, *trace_event_p;
+typedef struct trace_header_s trace_header_t, *trace_header_p;
+typedef struct trace_buffer_s trace_buffer_t, *trace_buffer_p;
+
+/* Profile of an instruction */
+struct instruction_profile_s {
+    index_t pc;
+    unsigned long count;
+};
+
+typedef struct instruction_profile_s instruction_profile_t, *instruction_profile_p;
+
+/* Header of a snapshot record (followed by the procedure table, the call     */
+/* stack and the pages); a snapshot file holds a record of the whole tape     */
+/* followed by records of the pages changed since the previous one            */
+struct checkpoint_header_s {
+    char magic[8];
+    unsigned long version;
+    unsigned long layout;        /* sizes of long and of a cell             */
+    unsigned long program_hash;  /* FNV-1a of the instructions and the data */
+    unsigned long is_full;       /* 1 - whole tape; 0 - changed pages       */
+    unsigned long size;          /* bytes after the header                  */
+    unsigned long checksum;      /* FNV-1a of the record (checksum 0)       */
+    unsigned long input_count;   /* input bytes consumed                    */
+    unsigned long output_count;  /* output bytes written                    */
+    long pc;                     /* next instruction                        */
+    long cell;                   /* current cell                            */
+    long procedure_count;        /* 0 or PROCEDURE_COUNT                    */
+    long call_depth;
+    long page_count;
+};
+
+/* Page of a snapshot record (followed by count cells) */
+struct checkpoint_page_s {
+    long first;                  /* index of the first cell                 */
+    long count;
+};
+
+/* Snapshots of a run */
+struct checkpoint_s {
+    char filename[MAX_FILE_NAME_LENGTH + 16];
+    tape_p tape;                 /* NULL - no snapshots and no resume       */
+    unsigned long program_hash;
+    long interval;               /* operations or seconds (0 - none)        */
+    long countdown;              /* operations until the next snapshot or   */
+                                 /* clock check                             */
+    time_t due;                  /* time of the next snapshot (seconds)     */
+    long file_size;              /* end of the valid records (0 - no file)  */
+    long full_size;              /* size of the last full record            */
+    unsigned char* dirty;        /* dense tape: page written since the last */
+                                 /* snapshot (NULL - every page)            */
+    long dirty_first;            /* page of dirty[0]                        */
+    long dirty_count;
+    index_t pc;                  /* where the run starts (resume)           */
+    long cell;
+};
+
+typedef struct checkpoint_header_s checkpoint_header_t, *checkpoint_header_p;
+typedef struct checkpoint_page_s checkpoint_page_t, *checkpoint_page_p;
+typedef struct checkpoint_s checkpoint_t, *checkpoint_p;
+
+/* State of one run of a program: everything the engines change besides the  */
+/* tape; one per thread, the options and the compiled program are shared      */
+struct context_s {
+    const program_options_t* options;
+    const char* input_filename;     /* "" - standard input                 */
+    const char* output_filename;    /* "" - standard output                */
+    const unsigned char* input_data;/* input in memory or NULL             */
+    size_t input_size;
+    bfplus_read_t read;             /* input callback or NULL              */
+    bfplus_write_t write;           /* output callback or NULL             */
+    void* user;                     /* argument of the callbacks           */
+    output_buffer_t output;
+    input_buffer_t input;
+    trace_buffer_t trace;           /* events == NULL - not recorded       */
+    unsigned long* profile_counts;  /* execution count of each instruction */
+    index_t* procedures;            /* '(' of each procedure or -1         */
+    index_t* calls;                 /* call stack (index of each call)     */
+    index_t call_depth;
+    int jit_result;                 /* -1 - the native code failed         */
+    unsigned long input_count;      /* input bytes consumed                */
+    unsigned long output_count;     /* output bytes written                */
+    checkpoint_t checkpoint;
+    long steps;                     /* step budget left (0 - no limits)    */
+    volatile sig_atomic_t limit;    /* limit reached (limit_t)             */
+};
+
+typedef struct context_s context_t, *context_p;
+
+/* Engine specialized for one cell type (see bf+_engine.h) */
+struct cell_engine_s {
+    unsigned int bits;
+    unsigned char is_signed;
+    const char* type_name;   /* C type of a cell (emit-c)                  */
+    int (*run)(context_p context, const program_t* program, void* cells);
+    int (*run_threaded)(context_p context, const program_t* program, void* cells);
+    int (*run_sparse)(context_p context, const program_t* program, tape_p tape);
+    void* (*scan)(void* cell, long stride);
+    void (*jit_data_output)(const jit_callbacks_t* callbacks, void* cell);
+    int (*jit_data_input)(const jit_callbacks_t* callbacks, void* cell);
 };
 
+typedef struct cell_engine_s cell_engine_t, *cell_engine_p;
+
+/* Program of the library: compiled with a copy of the options, not changed   */
+/* afterwards                                                                 */
+struct bfplus_program_s {
+    program_options_t options;
+    const cell_engine_t* engine;
+    program_t program;
+};
+
+/* Virtual machine of the library: the tape and the context of its runs and   */
+/* where the input comes from and the output goes to                          */
+struct bfplus_vm_s {
+    tape_t tape;
+    size_t cell_size;           /* cell size of the tape (0 - no tape)     */
+    unsigned char is_infinite;  /* the tape has infinite cells             */
+    unsigned char is_sparse;    /* the tape is sparse                      */
+    unsigned char is_dirty;     /* the tape has been used since cleared    */
+    context_t context;
+    bfplus_read_t read;         /* input callback or NULL                  */
+    bfplus_write_t write;       /* output callback or NULL                 */
+    void* user;                 /* argument of the callbacks               */
+    const unsigned char* input; /* input buffer or NULL                    */
+    size_t input_size;
+    unsigned char* output;      /* output buffer or NULL                   */
+    size_t output_size;
+    size_t output_capacity;
+    char input_filename[MAX_FILE_NAME_LENGTH];  /* "" - standard input     */
+    char output_filename[MAX_FILE_NAME_LENGTH]; /* "" - standard output    */
+};
+
+typedef bfplus_program_t* bfplus_program_p;
+typedef bfplus_vm_t* bfplus_vm_p;
+
+/* Program of the batch mode, compiled once for all jobs with its source */
+struct batch_program_s {
+    const char* source;      /* NULL - free entry of the table             */
+    bfplus_program_p program;/* NULL - failure                             */
+};
+
+/* Job of the batch mode (names point into the manifest text) */
+struct batch_job_s {
+    const char* source;
+    const char* input;       /* "-" - standard input                       */
+    const char* output;      /* "-" - standard output                      */
+    const struct batch_program_s* program;
+    long line;               /* line of the manifest                       */
+    int status;              /* 0 - success; -1 - failure                  */
+    double seconds;          /* wall time of the job                       */
+};
+
+/* Worker of the batch mode: runs the jobs [begin, end) on its own VM and     */
+/* steals the second half of the range of another worker when it is done     */
+struct batch_worker_s {
+    struct batch_s* batch;
+    long begin;              /* next job                                   */
+    long end;                /* end of the range of jobs                   */
+    long steals;             /* ranges taken from other workers            */
+    bfplus_vm_p vm;
+#if defined(USE_THREADS)
+    pthread_mutex_t lock;    /* guards begin and end                       */
+    pthread_t thread;
+    unsigned char is_started;
+#endif /* defined(USE_THREADS) */
+};
+
+/* Jobs and workers of the batch mode */
+struct batch_s {
+    struct batch_job_s* jobs;
+    struct batch_worker_s* workers;
+    unsigned int worker_count;
+};
+
+typedef struct batch_program_s batch_program_t, *batch_program_p;
+typedef struct batch_job_s batch_job_t, *batch_job_p;
+typedef struct batch_worker_s batch_worker_t, *batch_worker_p;
+typedef struct batch_s batch_t, *batch_p;
+
 /* ************************************************************************** */
 /* PROTOTYPES */
 /* ************************************************************************** */
-struct main_data_s* constructor_main_data(struct main_data_s** main_data);
-void destructor_main_data(struct main_data_s** main_data);
-/*
-void method_cell_add_fin(struct main_data_s*);
-void method_cell_add_inf(struct main_data_s*);
-void method_;
-void method_;
-void method_;
-void method_;
-*/
-static void method_hq9plus_h_output_dummy(void);
-static void method_hq9plus_q_output_dummy(FILE* f);
-static void method_hq9plus_9_output_dummy(void);
-static void method_hq9plus_h_output_real(void);
-static void method_hq9plus_q_output_real(FILE* f);
-static void method_hq9plus_9_output_real(void);
+static int method_hq9plus_h_output_real(program_p program, instruction_p instruction);
+static int method_hq9plus_q_output_real(program_p program, const char* source, long size,
+                                        instruction_p instruction);
+static int method_hq9plus_9_output_real(program_p program, instruction_p instruction);
 
+#if !defined(BFPLUS_LIBRARY)
 static void atexit_func(void);
 static void print_preamble(void);
 static void print_use_help(void);
@@ -249,159 +928,237 @@ static void print_help(void);
 static void print_author(void);
 static void print_version(void);
 static void print_show_information(void);
-static void read_config(void);
-static int is_command(code_t ch);
+#endif /* !defined(BFPLUS_LIBRARY) */
+static void default_options(program_options_p config);
+static int set_option(program_options_p config, const char* name, const char* value);
+static int read_config_file(program_options_p config, const char* filename);
+static int load_source(const char* filename, char** source, long* size);
+static int emit_instruction(program_p program, const instruction_t* instruction,
+                            const source_position_t* position);
+static int emit_data(program_p program, const void* bytes, size_t size,
+                     instruction_p instruction);
+static int compile_program(const program_options_t* config, const char* source, long size,
+                           program_p program);
+static int optimize_loop(const program_t* program, index_t begin, int wrap, program_p optimized);
+static int optimize_program(program_p program, const cell_engine_t* engine);
+static void known_reset(known_cells_p known, int is_zero);
+static int known_get(const known_cells_t* known, long offset, long* value);
+static void known_set(known_cells_p known, long offset, long value, int is_known);
+static long known_wrap(long value, const cell_engine_t* engine);
+static void known_apply(known_cells_p known, const instruction_t* instruction,
+                        const cell_engine_t* engine);
+static int optimize_procedures(program_p program, const cell_engine_t* engine);
+static int optimize_offsets(program_p program);
+static void evaluate_run(const program_t* program, const program_options_t* config,
+                         const cell_engine_t* engine, const unsigned char* top, long limit,
+                         evaluation_p evaluation);
+static int evaluate_prefix(program_p program, const program_options_t* config,
+                           const cell_engine_t* engine);
+static void tape_range_use(tape_range_p range, long offset);
+static void tape_range_close(const tape_range_t* range, tape_range_p checks);
+static int insert_tape_checks(program_p program, const program_options_t* config);
+static void destroy_program(program_p program);
+#if defined(USE_POSIX_IO)
+static unsigned long cache_hash(unsigned long hash, const void* data, size_t size);
+static void cache_prepare(const program_options_t* config, const char* source, long size,
+                          cache_header_p header, char* filename);
+static int cache_check_code(const instruction_t* code, unsigned long size,
+                            unsigned long data_size);
+static int cache_load(const char* filename, const cache_header_t* expected, program_p program);
+static int cache_store(const char* filename, const cache_header_t* expected,
+                       const program_t* program);
+#endif /* defined(USE_POSIX_IO) */
+static const cell_engine_t* select_cell_engine(const program_options_t* config);
+static int create_tape(tape_p tape, size_t cell_size, int is_infinite, int is_sparse);
+static void destroy_tape(tape_p tape);
+static void clear_tape(tape_p tape);
+static void* sparse_page(tape_p tape, unsigned long number);
+#if defined(USE_GUARDED_TAPE)
+static void tape_fault_handler(int sig, siginfo_t* info, void* context);
+#endif /* defined(USE_GUARDED_TAPE) */
+static void init_context(context_p context, const program_options_t* config,
+                         const char* input_filename, const char* output_filename);
+static int output_send(context_p context, const void* first, size_t first_size,
+                       const void* second, size_t second_size);
+static int output_open(context_p context);
+static void output_flush(context_p context);
+static void output_write(context_p context, const void* bytes, size_t count);
+static int output_close(context_p context);
+static void data_output(context_p context, cell_t value);
+static int input_open(context_p context);
+static int input_fill(context_p context);
+static void input_close(context_p context);
+#if defined(USE_POSIX_IO)
+static void signal_handler(int sig);
+#endif /* defined(USE_POSIX_IO) */
+static int data_input(context_p context, cell_t* value);
+static void print_trace_legend(void);
+static void print_trace_event(const trace_event_t* event);
+static int trace_open(context_p context);
+static long trace_offset(const instruction_t* instruction);
+static void trace_record(context_p context, index_t pc, const instruction_t* instruction,
+                         long cell, long value);
+static int trace_dump(const trace_buffer_t* trace, const char* filename);
+static void trace_close(context_p context);
+#if !defined(BFPLUS_LIBRARY)
+static int decode_trace(const char* filename);
+#endif /* !defined(BFPLUS_LIBRARY) */
+static int profile_open(context_p context, const program_t* program);
+static int compare_loop_profiles(const void* first, const void* second);
+static int compare_profile_counts(const void* first, const void* second);
+static void print_profile(const context_t* context, const program_t* program);
+static void profile_close(context_p context);
+static void data_write(context_p context, const program_t* program,
+                       const instruction_t* instruction);
+static void tape_error(long cell, const instruction_t* instruction);
+static int procedure_open(context_p context, const program_t* program);
+static int procedure_define(context_p context, cell_t number, index_t pc);
+static index_t procedure_call(context_p context, cell_t number, index_t target, index_t pc);
+static void procedure_close(context_p context);
+#if defined(USE_POSIX_IO)
+static long checkpoint_page(long cell);
+static void checkpoint_reset(context_p context);
+static void checkpoint_touch(context_p context, const instruction_t* instruction, long cell);
+static int checkpoint_put(FILE* file, const void* data, size_t size, unsigned long* hash);
+static int checkpoint_put_page(FILE* file, const unsigned char* cells, long first, long count,
+                               size_t cell_size, int skip_zero, unsigned long* hash);
+static int checkpoint_write(context_p context, index_t pc, long cell);
+static void checkpoint_tick(context_p context, index_t pc, long cell);
+static int checkpoint_apply(context_p context, const program_t* program,
+                            const checkpoint_header_t* header, const unsigned char* payload);
+static int checkpoint_load(context_p context, const program_t* program);
+static int checkpoint_open(context_p context, const program_t* program, tape_p tape);
+static void checkpoint_close(context_p context);
+#endif /* defined(USE_POSIX_IO) */
+static int limit_open(context_p context);
+#if defined(USE_POSIX_IO)
+static void limit_alarm(int sig);
+#endif /* defined(USE_POSIX_IO) */
+static int limit_reached(context_p context, long steps);
+static void limit_close(context_p context);
+static void jit_data_write(const jit_callbacks_t* callbacks, long pc);
+static void jit_tape_error(const jit_callbacks_t* callbacks, long pc, long cell);
+static void jit_limit_reached(const jit_callbacks_t* callbacks, long pc);
+static int jit_emit(jit_buffer_p buffer, const unsigned char* bytes, size_t count);
+static void jit_store_value(unsigned char* bytes, long value, size_t count);
+static int jit_emit_value(jit_buffer_p buffer, long value, size_t count);
+static int jit_emit_cell(jit_buffer_p buffer, size_t cell_size, const unsigned char* opcode);
+static int jit_compile(const program_t* program, size_t cell_size, int limits,
+                       jit_buffer_p buffer);
+static int run_program_jit(context_p context, const program_t* program,
+                           const cell_engine_t* engine, void* cells);
+static int execute_program(context_p context, const program_t* program,
+                           const cell_engine_t* engine, tape_p tape);
+static long vm_read(void* user, unsigned char* data, unsigned long size);
+static int vm_write(void* user, const unsigned char* data, unsigned long size);
+#if !defined(BFPLUS_LIBRARY)
+static int emit_c_program(const program_t* program, const cell_engine_t* engine, FILE* file);
+static int emit_c(const program_t* program, const cell_engine_t* engine);
 static int control(void);
 static int work(void);
+static double batch_clock(void);
+static int batch_parse(char* text, long size, batch_job_p* jobs, long* count);
+static batch_program_p batch_find_program(batch_program_p table, unsigned long mask,
+                                          const char* source);
+static batch_job_p batch_next_job(batch_worker_p worker);
+static void* batch_run_jobs(void* data);
+static int batch(void);
 int main(const int argc, char* const* argv);
+#endif /* !defined(BFPLUS_LIBRARY) */
 
 /* ************************************************************************** */
 /* GLOBAL VARIABLE */
 /* ************************************************************************** */
+#if !defined(BFPLUS_LIBRARY)
 program_options_t options;
+#endif /* !defined(BFPLUS_LIBRARY) */
 
-/* ************************************************************************** */
-/* FUNCTIONS */
-/* ************************************************************************** */
-
-/* Выделение памяти */
-struct main_data_s* constructor_main_data(struct main_data_s** main_data) {
-    *main_data = (struct main_data_s*) calloc(1, sizeof(struct main_data_s));
-    if(*main_data) {
-        (*main_data)->cells = (union main_data_cells_u*) calloc(1, sizeof(union main_data_cells_u));
-        if(!(*main_data)->cells) {
-            goto allocation_memory;
-        }
-
-        (*main_data)->loops = (union main_data_loops_u*) calloc(1, sizeof(union main_data_loops_u));
-        if(!(*main_data)->loops) {
-            goto allocation_memory;
-        }
-
-        if(options.use_infinite_cells) {
-
-        }
-        else {
-
-        }
-
-        if(options.use_infinite_nested_loops) {
-
-        }
-        else {
-
-        }
-
-        if(options.use_syntax_hq9plus) {
-            (*main_data)->hq9plus_h_output = method_hq9plus_h_output_real;
-            (*main_data)->hq9plus_q_output = method_hq9plus_q_output_real;
-            (*main_data)->hq9plus_9_output = method_hq9plus_9_output_real;
-        }
-        else {
-            (*main_data)->hq9plus_h_output = method_hq9plus_h_output_dummy;
-            (*main_data)->hq9plus_q_output = method_hq9plus_q_output_dummy;
-            (*main_data)->hq9plus_9_output = method_hq9plus_9_output_dummy;
-        }
-    }
-
-    goto ok;
+#if defined(USE_GUARDED_TAPE)
+/* Guarded tapes in use (one per thread) and the fault handlers they replaced */
+static tape_p volatile guarded_tapes[GUARDED_TAPE_SLOTS];
+static int guarded_tape_count = 0;
+static struct sigaction guarded_tape_old_segv;
+static struct sigaction guarded_tape_old_bus;
+#if defined(USE_THREADS)
+static pthread_mutex_t guarded_tape_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif /* defined(USE_THREADS) */
+#endif /* defined(USE_GUARDED_TAPE) */
 
-allocation_memory:
-    destructor_main_data(main_data);
-
-ok:
-    return *main_data;
-}
-
-/* Освобождение памяти */
-void destructor_main_data(struct main_data_s** main_data) {
-
-}
-
-/* -------------------------------------------------------------------------- */
-/* Function: method_hq9plus_h_output_dummy                                    */
-/* Description: */
-/* Parameters: */
-/* Return: */
-/* Note: */
-/* -------------------------------------------------------------------------- */
-void method_hq9plus_h_output_dummy(void) {
-}
+/* Context of the program run by the main thread (signals, exit) or NULL */
+static context_p volatile main_context = NULL;
 
-/* -------------------------------------------------------------------------- */
-/* Function: method_hq9plus_q_output_dummy                                    */
-/* Description: */
-/* Parameters: */
-/* Return: */
-/* Note: */
-/* -------------------------------------------------------------------------- */
-void method_hq9plus_q_output_dummy(FILE* f) {
-    (void) f;
-}
+/* Context of the run with a time limit (SIGALRM) or NULL, and the handler */
+static context_p volatile limit_context = NULL;
+#if defined(USE_POSIX_IO)
+static struct sigaction limit_old_alarm;
+#endif /* defined(USE_POSIX_IO) */
 
-/* -------------------------------------------------------------------------- */
-/* Function: method_hq9plus_9_output_dummy                                    */
-/* Description: */
-/* Parameters: */
-/* Return: */
-/* Note: */
-/* -------------------------------------------------------------------------- */
-void method_hq9plus_9_output_dummy(void) {
-}
+/* ************************************************************************** */
+/* FUNCTIONS */
+/* ************************************************************************** */
 
 /* -------------------------------------------------------------------------- */
 /* Function: method_hq9plus_h_output_real                                     */
-/* Description: */
-/* Parameters: */
-/* Return: */
+/* Description: appends the output of the HQ9+ 'H' to the program data       */
+/* Parameters: program - compiled program                                     */
+/*             instruction - data_write_op (out)                              */
+/* Return: 0 - success; -1 - failure                                          */
 /* Note: */
 /* -------------------------------------------------------------------------- */
-void method_hq9plus_h_output_real(void) {
-    (void) printf("Hello world!\n");
+int method_hq9plus_h_output_real(program_p program, instruction_p instruction) {
+    static const char text[] = "Hello world!\n";
+
+    return emit_data(program, text, sizeof(text) - 1, instruction);
 }
 
 /* -------------------------------------------------------------------------- */
 /* Function: method_hq9plus_q_output_real                                     */
-/* Description: */
-/* Parameters: */
-/* Return: */
+/* Description: appends the output of the HQ9+ 'Q' (the source text) to the  */
+/*              program data                                                  */
+/* Parameters: program - compiled program                                     */
+/*             source - source text                                           */
+/*             size - size of the source in bytes                             */
+/*             instruction - data_write_op (out)                              */
+/* Return: 0 - success; -1 - failure                                          */
 /* Note: */
 /* -------------------------------------------------------------------------- */
-void method_hq9plus_q_output_real(FILE* f) {
-    int ch = 0;
-    fpos_t pos;
-
-    fgetpos(f, &pos);
-    rewind(f);
-
-    while((ch = fgetc(f)) != EOF) {
-        fputc(ch, stdout);
-    }
-
-    fsetpos(f, &pos);
+int method_hq9plus_q_output_real(program_p program, const char* source, long size,
+                                 instruction_p instruction) {
+    return emit_data(program, source, (size_t) size, instruction);
 }
 
 /* -------------------------------------------------------------------------- */
 /* Function: method_hq9plus_9_output_real                                     */
-/* Description: */
-/* Parameters: */
-/* Return: */
+/* Description: appends the output of the HQ9+ '9' to the program data        */
+/* Parameters: program - compiled program                                     */
+/*             instruction - data_write_op (out)                              */
+/* Return: 0 - success; -1 - failure                                          */
 /* Note: */
 /* -------------------------------------------------------------------------- */
-void method_hq9plus_9_output_real(void) {
+int method_hq9plus_9_output_real(program_p program, instruction_p instruction) {
+    static const char text[] =
+        "1 bottle of beer on the wall, 1 bottle of beer.\n"
+        "Take one down and pass it around, no more bottles of beer on the wall.\n\n"
+        "No more bottles of beer on the wall, no more bottles of beer.\n"
+        "Go to the store and buy some more, 99 bottles of beer on the wall.\n";
+    char line[OUTPUT_LINE_SIZE];
     int i = 0;
 
     for(i = 99; i > 1; i--) {
-        (void) printf("%i bottles of beer on the wall, %i bottles of beer.\n", i, i);
-        (void) printf("Take one down and pass it around, %i bottles of beer on the wall.\n\n", i - 1);
+        (void) sprintf(line, "%i bottles of beer on the wall, %i bottles of beer.\n", i, i);
+        if(emit_data(program, line, strlen(line), instruction)) {
+            return -1;
+        }
+        (void) sprintf(line, "Take one down and pass it around, %i bottles of beer on the wall.\n\n", i - 1);
+        if(emit_data(program, line, strlen(line), instruction)) {
+            return -1;
+        }
     }
 
-    (void) printf("1 bottle of beer on the wall, 1 bottle of beer.\n");
-    (void) printf("Take one down and pass it around, no more bottles of beer on the wall.\n\n");
-    (void) printf("No more bottles of beer on the wall, no more bottles of beer.\n");
-    (void) printf("Go to the store and buy some more, 99 bottles of beer on the wall.\n");
+    return emit_data(program, text, sizeof(text) - 1, instruction);
 }
 
+#if !defined(BFPLUS_LIBRARY)
 /* -------------------------------------------------------------------------- */
 /* Function: atexit_func                                                      */
 /* Description: */
@@ -410,6 +1167,14 @@ void method_hq9plus_9_output_real(void) {
 /* Note: */
 /* -------------------------------------------------------------------------- */
 void atexit_func(void) {
+    context_p context = main_context;
+
+    if(context) {
+        output_flush(context);
+        input_close(context);
+        trace_close(context);
+    }
+
     if(!options.quiet_exit) {
         (void) printf("Bye!\n");
     }
@@ -506,10 +1271,30 @@ void print_show_information(void) {
                   options.config_filename);
     (void) printf("\tsource filename: %s\n",
                   options.source_filename);
+    (void) printf("\temit C filename: %s\n",
+                  options.emit_c_filename);
+    (void) printf("\tinput filename: %s\n",
+                  options.input_filename);
+    (void) printf("\toutput filename: %s\n",
+                  options.output_filename);
+    (void) printf("\tbatch filename: %s\n",
+                  options.batch_filename);
+    (void) printf("\ttrace filename: %s\n",
+                  options.trace_filename);
+    (void) printf("\tcache directory: %s\n",
+                  options.cache_directory);
     (void) printf("\tverbose mode: %d\n",
                   options.verbose);
     (void) printf("\tshow info: %d\n",
                   options.show_info);
+    (void) printf("\tengine: %s\n",
+                  threaded_engine == options.engine ? ENGINE_NAME_THREADED : ENGINE_NAME_SWITCH);
+    (void) printf("\tjit: %d\n",
+                  options.jit);
+    (void) printf("\tprofile: %d\n",
+                  options.profile);
+    (void) printf("\tjobs: %u\n",
+                  options.jobs);
     (void) printf("\tcomment flags.use_type1: %d\n",
                   options.comment.comment_flags.use_type1);
     (void) printf("\tcomment flags.use_type2: %d\n",
@@ -522,8 +1307,12 @@ void print_show_information(void) {
                   options.comment.use_comment);
     (void) printf("\tuse infinite cells: %d\n",
                   options.use_infinite_cells);
+    (void) printf("\tuse sparse cells: %d\n",
+                  options.use_sparse_cells);
     (void) printf("\tuse infinite nested loops: %d\n",
                   options.use_infinite_nested_loops);
+    (void) printf("\tuse safe tape: %d\n",
+                  options.use_safe_tape);
     (void) printf("\tuse negative value: %d\n",
                   options.use_negative_value);
     (void) printf("\tuse large cell size: %d\n",
@@ -542,420 +1331,6227 @@ void print_show_information(void) {
                   options.use_mod255);
     (void) printf("\tuse force rn: %d\n",
                   options.use_force_rn);
+    (void) printf("\tcell size: %u\n",
+                  options.use_large_cell_size ? options.cell_size : CHAR_BIT);
+    (void) printf("\toutput buffer size: %lu\n",
+                  options.output_buffer_size);
+    (void) printf("\ttrace events: %lu\n",
+                  options.trace_events);
+    (void) printf("\ttrace sample: %lu\n",
+                  options.trace_sample);
+    (void) printf("\tmax steps: %ld\n",
+                  options.max_steps);
+    (void) printf("\tmax time: %ld ms\n",
+                  options.max_time);
+    (void) printf("\tmax output: %lu\n",
+                  options.max_output);
+    (void) printf("\tcheckpoint every: %ld%s\n",
+                  options.checkpoint_interval, options.checkpoint_seconds ? "s" : "");
+    (void) printf("\tresume filename: %s\n",
+                  options.resume_filename);
+    (void) printf("\teof value: %s\n",
+                  zero_eof == options.eof_value ? EOF_NAME_ZERO :
+                  (unchanged_eof == options.eof_value ? EOF_NAME_UNCHANGED : EOF_NAME_MINUS_ONE));
     (void) printf("\tMAX FILENAME LENGTH: %d\n",
                   MAX_FILE_NAME_LENGTH);
     (void) printf("\tSTATIC CELL COUNT: %d\n",
                   STATIC_CELL_COUNT);
 }
 
-/* -------------------------------------------------------------------------- */
-/* Function: read_config                                                      */
-/* Description: */
-/* Parameters: */
-/* Return: */
-/* Note: */
-/* -------------------------------------------------------------------------- */
-void read_config(void) {
-    FILE* cfg_file = NULL;
-    char str_param[1024];
-    char* lexem;
-
-    if(strlen(options.config_filename)) {
-        if((cfg_file = fopen(options.config_filename, "r")) == NULL) {
-            perror("File not open");
-            return;
-        }
-
-        while(!feof(cfg_file)) {
-            if(fgets(str_param, 1024, cfg_file)) {
-                if(strlen(str_param)) {
-                    if(*str_param != '#') {
-                        lexem = strtok(str_param, ": ");
-                        if(!strcmp(lexem, PARAM_NAME_USE_COMMENT_TYPE1)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.comment.comment_flags.use_type1 = 1;
-                                }
-                                else {
-                                    options.comment.comment_flags.use_type1 = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_COMMENT_TYPE2)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.comment.comment_flags.use_type2 = 1;
-                                }
-                                else {
-                                    options.comment.comment_flags.use_type2 = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_COMMENT_TYPE3)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.comment.comment_flags.use_type3 = 1;
-                                }
-                                else {
-                                    options.comment.comment_flags.use_type3 = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_COMMENT_TYPE4)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.comment.comment_flags.use_type4 = 1;
-                                }
-                                else {
-                                    options.comment.comment_flags.use_type4 = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_INFINITE_CELLS)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_infinite_cells = 1;
-                                }
-                                else {
-                                    options.use_infinite_cells = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_INFINITE_NESTED_LOOPS)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_infinite_nested_loops = 1;
-                                }
-                                else {
-                                    options.use_infinite_nested_loops = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_NEGATIVE_VALUE)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_negative_value = 1;
-                                }
-                                else {
-                                    options.use_negative_value = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_LARGE_CELL_SIZE)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_large_cell_size = 1;
-                                }
-                                else {
-                                    options.use_large_cell_size = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_FAST_INPUT)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_fast_input = 1;
-                                }
-                                else {
-                                    options.use_fast_input = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_PROCEDURE)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_procedure = 1;
-                                }
-                                else {
-                                    options.use_procedure = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_SYMBOL_EQUAL)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_symbol_equal = 1;
-                                }
-                                else {
-                                    options.use_symbol_equal = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_SYMBOL_UNDER)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_symbol_under = 1;
-                                }
-                                else {
-                                    options.use_symbol_under = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_SYNTAX_HQ9PLUS)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_syntax_hq9plus = 1;
-                                }
-                                else {
-                                    options.use_syntax_hq9plus = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_MOD255)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_mod255 = 1;
-                                }
-                                else {
-                                    options.use_mod255 = 0;
-                                }
-                            }
-                        }
-                        else if(!strcmp(lexem, PARAM_NAME_USE_FORCE_RN)) {
-                            lexem = strtok('\0', " \r\n");
-                            if(lexem) {
-                                if(!strcmp(lexem, "true")) {
-                                    options.use_force_rn = 1;
-                                }
-                                else {
-                                    options.use_force_rn = 0;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-
-        fclose(cfg_file);
-    }
-}
-
-/* -------------------------------------------------------------------------- */
-/* Function: is_command                                                       */
-/* Description: */
-/* Parameters: */
-/* Return: */
-/* Note: */
-/* -------------------------------------------------------------------------- */
-int is_command(code_t ch) {
-	return (ch == '>' ||
-			ch == '<' ||
-			ch == '+' ||
-			ch == '-' ||
-			ch == '.' ||
-			ch == ',' ||
-			ch == '[' ||
-			ch == ']');
-}
+#endif /* !defined(BFPLUS_LIBRARY) */
 
 /* -------------------------------------------------------------------------- */
-/* Function: control                                                          */
-/* Description: */
-/* Parameters: */
+/* Function: default_options                                                  */
+/* Description: sets the options to their defaults                            */
+/* Parameters: config - options (out)                                         */
 /* Return: */
-/* Note: */
+/* Note: 64-bit signed cells, buffered output, no extensions                  */
 /* -------------------------------------------------------------------------- */
-int control(void) {
-	if(!options.source_filename[0]) {
-		return -1;
-	}
-
-	return 0;
+void default_options(program_options_p config) {
+    (void) memset(config, 0, sizeof(program_options_t));
+    config->use_negative_value = 1;
+    config->use_large_cell_size = 1;
+    config->cell_size = DEFAULT_CELL_SIZE;
+    config->output_buffer_size = OUTPUT_BUFFER_SIZE;
+    config->trace_events = TRACE_EVENT_COUNT;
+    config->trace_sample = 1;
+    config->jobs = 1;
 }
 
 /* -------------------------------------------------------------------------- */
-/* Function: work                                                             */
-/* Description: */
-/* Parameters: */
-/* Return: */
+/* Function: set_option                                                       */
+/* Description: sets an option of the configuration file                      */
+/* Parameters: config - options                                               */
+/*             name - name of the option (PARAM_NAME_...)                     */
+/*             value - value of the option ("true", "false", number, ...)     */
+/* Return: 0 - success; -1 - unknown option                                   */
 /* Note: */
 /* -------------------------------------------------------------------------- */
-int work(void) {
-	FILE* file_code = NULL;
-	code_t code = 0;
-	mode_t mode = unknown_mode;
-	cell_p cells = NULL;
-	cell_p current_cell = NULL;
-	index_t current_index = 0;
-    loop_position_t loops_pos[1024];
-    int loops_pos_index = -1;
-    int local_loops_pos_index = 0;
-
-    (void) memset(loops_pos, 0, 1024 * sizeof(loop_position_t));
-
-    if(options.show_info) {
-        print_show_information();
+int set_option(program_options_p config, const char* name, const char* value) {
+    if(!strcmp(name, PARAM_NAME_USE_COMMENT_TYPE1)) {
+        if(!strcmp(value, "true")) {
+            config->comment.comment_flags.use_type1 = 1;
+        }
+        else {
+            config->comment.comment_flags.use_type1 = 0;
+        }
     }
-
-    cells = (cell_p) calloc(STATIC_CELL_COUNT, sizeof(cell_t));
-	if(!cells) {
-		perror("Memory error");
-		return EXIT_FAILURE;
-	}
-
-	if((file_code = fopen(options.source_filename, "r")) == NULL) {
-		perror("File not open");
-		return EXIT_FAILURE;
-	}
-
-	if(options.verbose) {
-		(void) printf("Verbose mode!\n");
-		(void) printf("* - command\n");
-		(void) printf("symbol - current readable symbol (HEX)\n");
-		(void) printf("ccn - current cell number (HEX)\n");
-		(void) printf("ccv - current cell value (HEX/OCT/DEC)\n");
-		(void) printf("----------------------------------------\n");
-	}
-
-	current_cell = cells;
-	current_index = 0;
-	mode = command_mode;
-	while((code = fgetc(file_code)) != EOF) {
-		if(options.verbose) {
-			(void) printf("%c \'%c\' symbol=0x%02X; ccn=%ld; ccv=0x%04lX; ccv=0%05lo; ccv=%li;\n",
-                          ((comment_mode != mode && is_command(code)) ? '*' : ' '),
-						  (isprint(code) ? code : ' '),
-						  (int) code,
-						  (unsigned long int)(current_cell - cells),
-						  (unsigned long int) *current_cell,
-						  (unsigned long int) *current_cell,
-						  (signed long int) *current_cell);
-		}
-
-		if(comment_mode == mode) {
-            if((options.comment.comment_flags.use_type1 && code == '|') ||
-               (options.comment.comment_flags.use_type2 && code == '}') ||
-               (options.comment.comment_flags.use_type3 && code == '*') ||
-               (options.comment.comment_flags.use_type4 && code == '#')) {
-				mode = command_mode;
-                continue;
-			}
-		}
-		if(command_mode == mode) {
-			switch(code) {
-			case '|':
-                if(options.comment.comment_flags.use_type1) {
-					mode = comment_mode;
-				}
-				break;
-			case '}':
-                if(options.comment.comment_flags.use_type2) {
-					mode = comment_mode;
-				}
-				break;
-			case '*': 
-                if(options.comment.comment_flags.use_type3) {
-					mode = comment_mode;
-				}
-				break;
-			case '#':
-                if(options.comment.comment_flags.use_type4) {
-					mode = comment_mode;
-				}
-				break;
-			case '>':
-				++current_cell;
-				++current_index; /* for verbose mode */
-				break;
-			case '<':
-				--current_cell;
-				--current_index; /* for verbose mode */
-				break;
-			case '+':
-				++*current_cell;
-				break;
-			case '-':
-				--*current_cell;
-				break;
-			case '.':
-				if(options.verbose) {
-					fputc('O', stdout);
-					fputc('>', stdout);
-					fputc(' ', stdout);
-				}
-
-				(void) fputc(*current_cell, stdout);
-
-				if(options.verbose) {
-					fputc('\n', stdout);
-				}
-				break;
-			case ',':
-				if(options.verbose) {
-					fputc('I', stdout);
-					fputc('>', stdout);
-					fputc(' ', stdout);
-				}
-
-				*current_cell = (int) fgetc(stdin);
-				break;
-			case '[':
-				if(!*current_cell) {
-                    if(loops_pos_index >= 0 && loops_pos[loops_pos_index].id_pos == ftell(file_code)) {
-                        fsetpos(file_code, &loops_pos[loops_pos_index].end_pos);
-                        loops_pos_index--;
-                        break;
-                    }
-
-                    local_loops_pos_index = 0;
-
-                    while((code = fgetc(file_code)) != ']' || local_loops_pos_index) {
-                        if(code == '[') {
-                            local_loops_pos_index++;
-                        }
-                        else if(code == ']') {
-                            local_loops_pos_index--;
-                        }
-					}
-				}
-                else {
-                    /* Save */
-                    if(loops_pos_index < 0 || loops_pos[loops_pos_index].id_pos != ftell(file_code)) {
-                        loops_pos_index++;
-                        fgetpos(file_code, &loops_pos[loops_pos_index].begin_pos);
-                        loops_pos[loops_pos_index].id_pos = ftell(file_code);
-                    }
-                }
-				break;
-			case ']':
-				if(*current_cell) {
-                    fgetpos(file_code, &loops_pos[loops_pos_index].end_pos);
-                    fsetpos(file_code, &loops_pos[loops_pos_index].begin_pos);
-                    fseek(file_code, -1, SEEK_CUR);
-				}
-                else {
-                    loops_pos_index--;
-                }
-				break;
-			default:
-				break;
-			}
-		}
+    else if(!strcmp(name, PARAM_NAME_USE_COMMENT_TYPE2)) {
+        if(!strcmp(value, "true")) {
+            config->comment.comment_flags.use_type2 = 1;
+        }
+        else {
+            config->comment.comment_flags.use_type2 = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_COMMENT_TYPE3)) {
+        if(!strcmp(value, "true")) {
+            config->comment.comment_flags.use_type3 = 1;
+        }
+        else {
+            config->comment.comment_flags.use_type3 = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_COMMENT_TYPE4)) {
+        if(!strcmp(value, "true")) {
+            config->comment.comment_flags.use_type4 = 1;
+        }
+        else {
+            config->comment.comment_flags.use_type4 = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_INFINITE_CELLS)) {
+        if(!strcmp(value, "true")) {
+            config->use_infinite_cells = 1;
+        }
+        else {
+            config->use_infinite_cells = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_SPARSE_CELLS)) {
+        if(!strcmp(value, "true")) {
+            config->use_sparse_cells = 1;
+        }
+        else {
+            config->use_sparse_cells = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_INFINITE_NESTED_LOOPS)) {
+        if(!strcmp(value, "true")) {
+            config->use_infinite_nested_loops = 1;
+        }
+        else {
+            config->use_infinite_nested_loops = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_SAFE_TAPE)) {
+        if(!strcmp(value, "true")) {
+            config->use_safe_tape = 1;
+        }
+        else {
+            config->use_safe_tape = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_NEGATIVE_VALUE)) {
+        if(!strcmp(value, "true")) {
+            config->use_negative_value = 1;
+        }
+        else {
+            config->use_negative_value = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_LARGE_CELL_SIZE)) {
+        if(!strcmp(value, "true")) {
+            config->use_large_cell_size = 1;
+        }
+        else {
+            config->use_large_cell_size = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_FAST_INPUT)) {
+        if(!strcmp(value, "true")) {
+            config->use_fast_input = 1;
+        }
+        else {
+            config->use_fast_input = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_PROCEDURE)) {
+        if(!strcmp(value, "true")) {
+            config->use_procedure = 1;
+        }
+        else {
+            config->use_procedure = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_SYMBOL_EQUAL)) {
+        if(!strcmp(value, "true")) {
+            config->use_symbol_equal = 1;
+        }
+        else {
+            config->use_symbol_equal = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_SYMBOL_UNDER)) {
+        if(!strcmp(value, "true")) {
+            config->use_symbol_under = 1;
+        }
+        else {
+            config->use_symbol_under = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_SYNTAX_HQ9PLUS)) {
+        if(!strcmp(value, "true")) {
+            config->use_syntax_hq9plus = 1;
+        }
+        else {
+            config->use_syntax_hq9plus = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_MOD255)) {
+        if(!strcmp(value, "true")) {
+            config->use_mod255 = 1;
+        }
+        else {
+            config->use_mod255 = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_USE_FORCE_RN)) {
+        if(!strcmp(value, "true")) {
+            config->use_force_rn = 1;
+        }
+        else {
+            config->use_force_rn = 0;
+        }
+    }
+    else if(!strcmp(name, PARAM_NAME_CELL_SIZE)) {
+        config->cell_size = (unsigned int) strtoul(value, NULL, 10);
+    }
+    else if(!strcmp(name, PARAM_NAME_OUTPUT_BUFFER_SIZE)) {
+        config->output_buffer_size = strtoul(value, NULL, 10);
+    }
+    else if(!strcmp(name, PARAM_NAME_TRACE_EVENTS)) {
+        config->trace_events = strtoul(value, NULL, 10);
+    }
+    else if(!strcmp(name, PARAM_NAME_TRACE_SAMPLE)) {
+        config->trace_sample = strtoul(value, NULL, 10);
+    }
+    else if(!strcmp(name, PARAM_NAME_CACHE_DIRECTORY)) {
+        (void) strncpy(config->cache_directory, value, MAX_FILE_NAME_LENGTH - 1);
+    }
+    else if(!strcmp(name, PARAM_NAME_EOF_VALUE)) {
+        if(!strcmp(value, EOF_NAME_ZERO)) {
+            config->eof_value = zero_eof;
+        }
+        else if(!strcmp(value, EOF_NAME_UNCHANGED)) {
+            config->eof_value = unchanged_eof;
+        }
+        else {
+            config->eof_value = minus_one_eof;
+        }
+    }
+    else {
+        return -1;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: read_config_file                                                 */
+/* Description: reads the options of a configuration file                     */
+/* Parameters: config - options                                               */
+/*             filename - configuration file name                             */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: one "name: value" per line; lines starting with '#' and unknown      */
+/*       options are skipped                                                  */
+/* -------------------------------------------------------------------------- */
+int read_config_file(program_options_p config, const char* filename) {
+    FILE* cfg_file = NULL;
+    char str_param[1024];
+    char* name = NULL;
+    char* value = NULL;
+
+    if((cfg_file = fopen(filename, "r")) == NULL) {
+        perror("File not open");
+        return -1;
+    }
+
+    while(!feof(cfg_file)) {
+        if(fgets(str_param, 1024, cfg_file)) {
+            if(strlen(str_param)) {
+                if(*str_param != '#') {
+                    name = strtok(str_param, ": ");
+                    value = strtok(NULL, " \r\n");
+                    if(name && value) {
+                        (void) set_option(config, name, value);
+                    }
+                }
+            }
+        }
+    }
+
+    fclose(cfg_file);
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: load_source                                                      */
+/* Description: reads the whole source file into memory                       */
+/* Parameters: filename - source file name                                    */
+/*             source - pointer to the allocated buffer (out)                 */
+/*             size - size of the source in bytes (out)                       */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the buffer must be released with free()                              */
+/* -------------------------------------------------------------------------- */
+int load_source(const char* filename, char** source, long* size) {
+    FILE* file_code = NULL;
+    char* buffer = NULL;
+    char* new_buffer = NULL;
+    long capacity = 0;
+    long length = 0;
+    size_t count = 0;
+
+    if((file_code = fopen(filename, "r")) == NULL) {
+        perror("File not open");
+        return -1;
+    }
+
+    do {
+        if(length + SOURCE_READ_BLOCK_SIZE > capacity) {
+            capacity = capacity ? capacity * 2 : SOURCE_READ_BLOCK_SIZE;
+            new_buffer = (char*) realloc(buffer, (size_t) capacity);
+            if(!new_buffer) {
+                perror("Memory error");
+                free(buffer);
+                fclose(file_code);
+                return -1;
+            }
+            buffer = new_buffer;
+        }
+
+        count = fread(buffer + length, 1, SOURCE_READ_BLOCK_SIZE, file_code);
+        length += (long) count;
+    } while(count == SOURCE_READ_BLOCK_SIZE);
+
+    if(ferror(file_code)) {
+        perror("File read error");
+        free(buffer);
+        fclose(file_code);
+        return -1;
+    }
+
+    fclose(file_code);
+
+    *source = buffer;
+    *size = length;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: emit_instruction                                                 */
+/* Description: appends an instruction to the compiled program                */
+/* Parameters: program - compiled program                                     */
+/*             instruction - instruction to append                            */
+/*             position - source position of the instruction (or NULL)        */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: positions are kept only if every instruction has one                 */
+/* -------------------------------------------------------------------------- */
+int emit_instruction(program_p program, const instruction_t* instruction,
+                     const source_position_t* position) {
+    instruction_p new_code = NULL;
+    source_position_p new_positions = NULL;
+    index_t new_capacity = 0;
+
+    if(program->size >= program->capacity) {
+        new_capacity = program->capacity ? program->capacity * 2 : 256;
+        new_code = (instruction_p) realloc(program->code,
+                                           (size_t) new_capacity * sizeof(instruction_t));
+        if(!new_code) {
+            perror("Memory error");
+            return -1;
+        }
+        program->code = new_code;
+
+        if(position) {
+            new_positions = (source_position_p) realloc(program->positions,
+                                                        (size_t) new_capacity * sizeof(source_position_t));
+            if(!new_positions) {
+                perror("Memory error");
+                return -1;
+            }
+            program->positions = new_positions;
+        }
+
+        program->capacity = new_capacity;
+    }
+
+    if(position) {
+        program->positions[program->size] = *position;
+    }
+
+    program->code[program->size++] = *instruction;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: emit_data                                                        */
+/* Description: appends constant output to the program data                   */
+/* Parameters: program - compiled program                                     */
+/*             bytes - output                                                 */
+/*             size - size of the output                                      */
+/*             instruction - data_write_op writing the output (extended if    */
+/*                           its arg is not 0: the output follows its own)    */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int emit_data(program_p program, const void* bytes, size_t size, instruction_p instruction) {
+    unsigned char* new_data = NULL;
+    long new_capacity = program->data_capacity;
+
+    if(program->data_size + (long) size > program->data_capacity) {
+        if(!new_capacity) {
+            new_capacity = 4096;
+        }
+        while(program->data_size + (long) size > new_capacity) {
+            new_capacity *= 2;
+        }
+
+        new_data = (unsigned char*) realloc(program->data, (size_t) new_capacity);
+        if(!new_data) {
+            perror("Memory error");
+            return -1;
+        }
+        program->data = new_data;
+        program->data_capacity = new_capacity;
+    }
+
+    if(!instruction->arg) {
+        instruction->op = data_write_op;
+        instruction->offset = program->data_size;
+    }
+
+    (void) memcpy(program->data + program->data_size, bytes, size);
+    program->data_size += (long) size;
+    instruction->arg += (long) size;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: compile_program                                                  */
+/* Description: strips comments and non-commands from the source and builds   */
+/*              the instruction array with resolved bracket jumps             */
+/* Parameters: config - options of the language                               */
+/*             source - source text                                           */
+/*             size - size of the source in bytes                             */
+/*             program - compiled program (out)                               */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: nesting of loops and procedures is limited by STATIC_LOOP_COUNT      */
+/*       unless use_infinite_nested_loops is set                              */
+/* -------------------------------------------------------------------------- */
+int compile_program(const program_options_t* config, const char* source, long size,
+                    program_p program) {
+    instruction_t instruction;
+    instruction_t hq9plus[3];
+    instruction_p hq9plus_write = NULL;
+    source_position_t position;
+    source_position_p instruction_position = config->profile ? &position : NULL;
+    work_mode_t mode = command_mode;
+    code_t code = 0;
+    index_p loops = NULL;
+    index_p new_loops = NULL;
+    index_t loops_capacity = STATIC_LOOP_COUNT;
+    index_t loops_index = -1;
+    long line = 1;
+    long column = 0;
+    long i = 0;
+
+    (void) memset(program, 0, sizeof(program_t));
+    (void) memset(hq9plus, 0, sizeof(hq9plus));
+
+    loops = (index_p) malloc((size_t) loops_capacity * sizeof(index_t));
+    if(!loops) {
+        perror("Memory error");
+        return -1;
+    }
+
+    for(i = 0; i < size; i++) {
+        code = (unsigned char) source[i];
+
+        if(code == '\n') {
+            line++;
+            column = 0;
+        }
+        else {
+            column++;
+        }
+
+        if(comment_mode == mode) {
+            if((config->comment.comment_flags.use_type1 && code == '|') ||
+               (config->comment.comment_flags.use_type2 && code == '}') ||
+               (config->comment.comment_flags.use_type3 && code == '*') ||
+               (config->comment.comment_flags.use_type4 && code == '#')) {
+                mode = command_mode;
+            }
+            continue;
+        }
+
+        instruction.jump = 0;
+        instruction.arg = 0;
+        instruction.offset = 0;
+        position.line = line;
+        position.column = column;
+
+        switch(code) {
+        case '|':
+            if(config->comment.comment_flags.use_type1) {
+                mode = comment_mode;
+            }
+            continue;
+        case '}':
+            if(config->comment.comment_flags.use_type2) {
+                mode = comment_mode;
+            }
+            continue;
+        case '*':
+            if(config->comment.comment_flags.use_type3) {
+                mode = comment_mode;
+            }
+            continue;
+        case '#':
+            if(config->comment.comment_flags.use_type4) {
+                mode = comment_mode;
+            }
+            continue;
+        case '>':
+        case '<':
+            instruction.op = cell_move_op;
+            instruction.arg = ('>' == code) ? 1 : -1;
+            break;
+        case '+':
+        case '-':
+            instruction.op = cell_add_op;
+            instruction.arg = ('+' == code) ? 1 : -1;
+            break;
+        case '.':
+            instruction.op = data_output_op;
+            break;
+        case ',':
+            instruction.op = data_input_op;
+            break;
+        case '=':
+            if(!config->use_symbol_equal) {
+                continue;
+            }
+            instruction.op = cell_clear_op;
+            break;
+        case 'H':
+        case 'Q':
+        case '9':
+            if(!config->use_syntax_hq9plus) {
+                continue;
+            }
+            /* Constant output, kept once in the data per command */
+            hq9plus_write = &hq9plus[('H' == code) ? 0 : ('Q' == code) ? 1 : 2];
+            if(!hq9plus_write->arg &&
+               (('H' == code && method_hq9plus_h_output_real(program, hq9plus_write)) ||
+                ('Q' == code && method_hq9plus_q_output_real(program, source, size,
+                                                             hq9plus_write)) ||
+                ('9' == code && method_hq9plus_9_output_real(program, hq9plus_write)))) {
+                goto error;
+            }
+            instruction = *hq9plus_write;
+            break;
+        case '(':
+            if(!config->use_procedure) {
+                continue;
+            }
+            /* fall through */
+        case '[':
+            if(loops_index + 1 >= loops_capacity) {
+                if(!config->use_infinite_nested_loops) {
+                    (void) fprintf(stderr,
+                                   "Syntax error: too many nested loops (line %ld, column %ld)\n",
+                                   line, column);
+                    goto error;
+                }
+
+                new_loops = (index_p) realloc(loops,
+                                              (size_t) loops_capacity * 2 * sizeof(index_t));
+                if(!new_loops) {
+                    perror("Memory error");
+                    goto error;
+                }
+                loops = new_loops;
+                loops_capacity *= 2;
+            }
+
+            loops[++loops_index] = program->size;
+            instruction.op = ('[' == code) ? loop_begin_op : procedure_begin_op;
+            break;
+        case ')':
+            if(!config->use_procedure) {
+                continue;
+            }
+            /* fall through */
+        case ']':
+            /* Loops and procedures must nest properly */
+            if(loops_index < 0 || program->code[loops[loops_index]].op !=
+                                  ((']' == code) ? loop_begin_op : procedure_begin_op)) {
+                (void) fprintf(stderr,
+                               "Syntax error: unmatched '%c' (line %ld, column %ld)\n",
+                               (int) code, line, column);
+                goto error;
+            }
+
+            instruction.op = (']' == code) ? loop_end_op : procedure_end_op;
+            instruction.jump = loops[loops_index--];
+            program->code[instruction.jump].jump = program->size;
+            break;
+        case ':':
+            if(!config->use_procedure) {
+                continue;
+            }
+            instruction.op = procedure_call_op;
+            break;
+        default:
+            continue;
+        }
+
+        /* Run-length folding: a run of '+'/'-' or '>'/'<' is one instruction */
+        if((cell_add_op == instruction.op || cell_move_op == instruction.op) &&
+           program->size && instruction.op == program->code[program->size - 1].op) {
+            program->code[program->size - 1].arg += instruction.arg;
+            if(!program->code[program->size - 1].arg) {
+                program->size--;
+            }
+            continue;
+        }
+
+        if(emit_instruction(program, &instruction, instruction_position)) {
+            goto error;
+        }
+    }
+
+    if(loops_index >= 0) {
+        (void) fprintf(stderr, "Syntax error: unmatched '%c'\n",
+                       loop_begin_op == program->code[loops[loops_index]].op ? '[' : '(');
+        goto error;
+    }
+
+    instruction.op = end_op;
+    instruction.jump = 0;
+    instruction.arg = 0;
+    instruction.offset = 0;
+    position.line = line;
+    position.column = column + 1;
+    if(emit_instruction(program, &instruction, instruction_position)) {
+        goto error;
+    }
+
+    free(loops);
+    return 0;
+
+error:
+    free(loops);
+    destroy_program(program);
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: optimize_loop                                                    */
+/* Description: rewrites a clear, copy or multiply loop into single ops       */
+/* Parameters: program - compiled program                                     */
+/*             begin - index of the loop_begin_op                             */
+/*             wrap - cells wrap around (narrow or unsigned cells)            */
+/*             optimized - program receiving the rewritten instructions       */
+/* Return: 1 - loop rewritten; 0 - loop is not an idiom; -1 - failure         */
+/* Note: a body of a single move is a scan loop; otherwise the body must      */
+/*       hold only add and move ops, return to the loop cell and decrement    */
+/*       it by exactly one per iteration (or increment it, if cells wrap);    */
+/*       the muladd ops and the clear are guarded by a LOOP_GUARD loop, so    */
+/*       the other cells are not touched when the loop cell is zero, as in    */
+/*       the original loop (the clear ends it: its ']' never jumps back)      */
+/* -------------------------------------------------------------------------- */
+int optimize_loop(const program_t* program, index_t begin, int wrap, program_p optimized) {
+    long offsets[MULADD_MAX_TARGETS];
+    long deltas[MULADD_MAX_TARGETS];
+    const source_position_t* position = program->positions ? &program->positions[begin] : NULL;
+    instruction_t instruction;
+    index_t end = program->code[begin].jump;
+    index_t guard = -1;
+    index_t pc = 0;
+    long offset = 0;
+    long loop_delta = 0;
+    int count = 0;
+    int i = 0;
+
+    instruction.jump = 0;
+    instruction.offset = 0;
+
+    /* Scan loop: the body is a single move */
+    if(end == begin + 2 && cell_move_op == program->code[begin + 1].op) {
+        instruction.op = cell_scan_op;
+        instruction.arg = program->code[begin + 1].arg;
+        return emit_instruction(optimized, &instruction, position) ? -1 : 1;
+    }
+
+    for(pc = begin + 1; pc < end; pc++) {
+        if(cell_move_op == program->code[pc].op) {
+            offset += program->code[pc].arg;
+        }
+        else if(cell_add_op == program->code[pc].op) {
+            if(!offset) {
+                loop_delta += program->code[pc].arg;
+                continue;
+            }
+
+            for(i = 0; i < count && offsets[i] != offset; i++) {
+            }
+
+            if(i == count) {
+                if(count == MULADD_MAX_TARGETS) {
+                    return 0;
+                }
+                offsets[count] = offset;
+                deltas[count] = 0;
+                count++;
+            }
+
+            deltas[i] += program->code[pc].arg;
+        }
+        else {
+            return 0;
+        }
+    }
+
+    if(offset || (loop_delta != -1 && (!wrap || loop_delta != 1))) {
+        return 0;
+    }
+
+    /* Incrementing loop: runs (0 - cell) times modulo the cell width */
+    for(i = 0; i < count; i++) {
+        if(!deltas[i]) {
+            continue;
+        }
+
+        if(guard < 0) {
+            guard = optimized->size;
+            instruction.op = loop_begin_op;
+            instruction.arg = LOOP_GUARD;
+            instruction.offset = 0;
+            if(emit_instruction(optimized, &instruction, position)) {
+                return -1;
+            }
+        }
+
+        instruction.op = cell_muladd_op;
+        instruction.arg = loop_delta < 0 ? deltas[i] : -deltas[i];
+        instruction.offset = offsets[i];
+        if(emit_instruction(optimized, &instruction, position)) {
+            return -1;
+        }
+    }
+
+    instruction.op = cell_clear_op;
+    instruction.arg = 0;
+    instruction.offset = 0;
+    if(emit_instruction(optimized, &instruction, position)) {
+        return -1;
+    }
+
+    if(guard >= 0) {
+        instruction.op = loop_end_op;
+        instruction.jump = guard;
+        instruction.arg = LOOP_GUARD;
+        if(emit_instruction(optimized, &instruction, position)) {
+            return -1;
+        }
+        optimized->code[guard].jump = optimized->size - 1;
+    }
+
+    return 1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: optimize_program                                                 */
+/* Description: replaces clear, copy and multiply loops with O(1) ops and     */
+/*              scan loops with cell_scan_op, then resolves procedure calls   */
+/*              and addresses the cells of straight-line code by offset       */
+/* Parameters: program - compiled program (rewritten in place)                */
+/*             engine - engine of the selected cell type                      */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: bracket jumps are resolved again for the rewritten program           */
+/* -------------------------------------------------------------------------- */
+int optimize_program(program_p program, const cell_engine_t* engine) {
+    program_t optimized;
+    index_p loops = NULL;
+    index_t loops_index = -1;
+    index_t pc = 0;
+    int wrap = engine->bits < sizeof(long) * CHAR_BIT || !engine->is_signed;
+    int result = 0;
+
+    (void) memset(&optimized, 0, sizeof(program_t));
+
+    loops = (index_p) malloc((size_t) program->size * sizeof(index_t));
+    if(!loops) {
+        perror("Memory error");
+        return -1;
+    }
+
+    for(pc = 0; pc < program->size; pc++) {
+        if(loop_begin_op == program->code[pc].op) {
+            result = optimize_loop(program, pc, wrap, &optimized);
+            if(result < 0) {
+                goto error;
+            }
+            else if(result) {
+                pc = program->code[pc].jump;
+                continue;
+            }
+
+            loops[++loops_index] = optimized.size;
+        }
+        else if(procedure_begin_op == program->code[pc].op) {
+            loops[++loops_index] = optimized.size;
+        }
+
+        if(emit_instruction(&optimized, &program->code[pc],
+                            program->positions ? &program->positions[pc] : NULL)) {
+            goto error;
+        }
+
+        if(loop_end_op == program->code[pc].op || procedure_end_op == program->code[pc].op) {
+            optimized.code[optimized.size - 1].jump = loops[loops_index];
+            optimized.code[loops[loops_index--]].jump = optimized.size - 1;
+        }
+    }
+
+    free(loops);
+    optimized.data = program->data;
+    optimized.data_size = program->data_size;
+    optimized.data_capacity = program->data_capacity;
+    program->data = NULL;
+    destroy_program(program);
+    *program = optimized;
+
+    if(optimize_procedures(program, engine)) {
+        return -1;
+    }
+
+    return optimize_offsets(program);
+
+error:
+    free(loops);
+    destroy_program(&optimized);
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: known_reset                                                      */
+/* Description: forgets the cells known to the optimizer                      */
+/* Parameters: known - known cells                                            */
+/*             is_zero - all cells are zero (start of the program)            */
+/* Return: */
+/* Note: the current cell becomes offset 0                                    */
+/* -------------------------------------------------------------------------- */
+void known_reset(known_cells_p known, int is_zero) {
+    known->count = 0;
+    known->pointer = 0;
+    known->is_zero = (unsigned char) (is_zero ? 1 : 0);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: known_get                                                        */
+/* Description: value of a cell if the optimizer knows it                     */
+/* Parameters: known - known cells                                            */
+/*             offset - cell (relative)                                       */
+/*             value - value of the cell (out)                                */
+/* Return: 1 - known; 0 - unknown                                             */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int known_get(const known_cells_t* known, long offset, long* value) {
+    int i = 0;
+
+    for(i = 0; i < known->count; i++) {
+        if(known->offsets[i] == offset) {
+            *value = known->values[i];
+            return known->is_known[i];
+        }
+    }
+
+    *value = 0;
+    return known->is_zero;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: known_set                                                        */
+/* Description: records the value of a cell                                   */
+/* Parameters: known - known cells                                            */
+/*             offset - cell (relative)                                       */
+/*             value - value of the cell                                      */
+/*             is_known - the value is known                                  */
+/* Return: */
+/* Note: everything is forgotten when the table is full                       */
+/* -------------------------------------------------------------------------- */
+void known_set(known_cells_p known, long offset, long value, int is_known) {
+    int i = 0;
+
+    for(i = 0; i < known->count && known->offsets[i] != offset; i++) {
+    }
+
+    if(i == known->count) {
+        if(!is_known && !known->is_zero) {
+            return;
+        }
+        if(KNOWN_CELL_COUNT == known->count) {
+            known->count = 0;
+            known->is_zero = 0;
+            if(!is_known) {
+                return;
+            }
+            i = 0;
+        }
+        known->count++;
+    }
+
+    known->offsets[i] = offset;
+    known->values[i] = value;
+    known->is_known[i] = (unsigned char) (is_known ? 1 : 0);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: known_wrap                                                       */
+/* Description: reduces a value to the range of the cell type                 */
+/* Parameters: value - value                                                  */
+/*             engine - engine of the selected cell type                      */
+/* Return: value as read back from a cell (converted to cell_t)               */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+long known_wrap(long value, const cell_engine_t* engine) {
+    unsigned long mask = 0;
+    unsigned long bits = 0;
+
+    if(engine->bits >= sizeof(long) * CHAR_BIT) {
+        return value;
+    }
+
+    mask = (1UL << engine->bits) - 1;
+    bits = (unsigned long) value & mask;
+    if(engine->is_signed && (bits >> (engine->bits - 1))) {
+        return -(long) (mask - bits) - 1;
+    }
+
+    return (long) bits;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: known_apply                                                      */
+/* Description: follows an instruction with the known cells                   */
+/* Parameters: known - known cells (before the instruction; updated)          */
+/*             instruction - instruction                                      */
+/*             engine - engine of the selected cell type                      */
+/* Return: */
+/* Note: gives the cells at the next instruction; the next instruction of a   */
+/*       bracket or a call is a jump target, so little is known there; the    */
+/*       caller handles procedure_begin_op and procedure_end_op; a LOOP_GUARD */
+/*       loop is followed straight through: its muladd ops do nothing to the  */
+/*       cells when the loop cell is zero, as when it is skipped              */
+/* -------------------------------------------------------------------------- */
+void known_apply(known_cells_p known, const instruction_t* instruction,
+                 const cell_engine_t* engine) {
+    long value = 0;
+    long target = 0;
+
+    switch(instruction->op) {
+    case cell_add_op:
+        target = known->pointer + instruction->offset;
+        if(known_get(known, target, &value)) {
+            value = (long) ((unsigned long) value + (unsigned long) instruction->arg);
+            known_set(known, target, known_wrap(value, engine), 1);
+        }
+        break;
+    case cell_move_op:
+        known->pointer += instruction->arg;
+        break;
+    case cell_clear_op:
+        known_set(known, known->pointer + instruction->offset, 0, 1);
+        break;
+    case cell_muladd_op:
+        if(known_get(known, known->pointer, &value) && !value) {
+            break;
+        }
+        if(known_get(known, known->pointer, &value) &&
+           known_get(known, known->pointer + instruction->offset, &target)) {
+            value = (long) ((unsigned long) target +
+                            (unsigned long) value * (unsigned long) instruction->arg);
+            known_set(known, known->pointer + instruction->offset, known_wrap(value, engine), 1);
+        }
+        else {
+            known_set(known, known->pointer + instruction->offset, 0, 0);
+        }
+        break;
+    case cell_set_op:
+        known_set(known, known->pointer + instruction->offset,
+                  known_wrap(instruction->arg, engine), 1);
+        break;
+    case data_input_op:
+        known_set(known, known->pointer + instruction->offset, 0, 0);
+        break;
+    case data_output_op:
+    case data_write_op:
+        break;
+    case loop_begin_op:
+        if(LOOP_GUARD != instruction->arg) {
+            known_reset(known, 0);
+        }
+        break;
+    case loop_end_op:
+    case cell_scan_op:
+        /* The current cell is zero after the loop */
+        if(loop_end_op != instruction->op || LOOP_GUARD != instruction->arg) {
+            known_reset(known, 0);
+        }
+        known_set(known, known->pointer, 0, 1);
+        break;
+    default:
+        known_reset(known, 0);
+        break;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: optimize_procedures                                              */
+/* Description: turns the pbrain calls of a known procedure into direct calls */
+/*              and inlines the small procedures that call no procedure       */
+/* Parameters: program - compiled program (rewritten in place)                */
+/*             engine - engine of the selected cell type                      */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the number of a procedure is a cell value, so this is done only      */
+/*       when every '(' is in the straight-line code at the start of the      */
+/*       program, where the cells are known: all procedures are defined       */
+/*       before the first call and never change; a call is resolved where     */
+/*       the current cell is known in its basic block                         */
+/* -------------------------------------------------------------------------- */
+int optimize_procedures(program_p program, const cell_engine_t* engine) {
+    program_t optimized;
+    known_cells_t known;
+    known_cells_t saved;
+    instruction_t instruction;
+    const source_position_t* position = NULL;
+    index_p procedures = NULL;
+    index_p moved = NULL;
+    index_p loops = NULL;
+    index_t loops_index = -1;
+    index_t definitions = 0;
+    index_t target = 0;
+    index_t end = 0;
+    index_t pc = 0;
+    index_t i = 0;
+    long value = 0;
+
+    for(pc = 0; pc < program->size; pc++) {
+        if(procedure_begin_op == program->code[pc].op) {
+            definitions++;
+        }
+    }
+
+    if(!definitions) {
+        return 0;
+    }
+
+    (void) memset(&optimized, 0, sizeof(program_t));
+
+    procedures = (index_p) malloc(PROCEDURE_COUNT * sizeof(index_t));
+    moved = (index_p) malloc((size_t) program->size * sizeof(index_t));
+    loops = (index_p) malloc((size_t) (program->size + PROCEDURE_INLINE_SIZE) * sizeof(index_t));
+    if(!procedures || !moved || !loops) {
+        perror("Memory error");
+        goto error;
+    }
+
+    for(i = 0; i < PROCEDURE_COUNT; i++) {
+        procedures[i] = -1;
+    }
+
+    /* Definitions of the straight-line code at the start */
+    known_reset(&known, 1);
+    for(pc = 0; pc < program->size; pc++) {
+        if(procedure_begin_op == program->code[pc].op) {
+            if(!known_get(&known, known.pointer, &value) || value < 0 || value >= PROCEDURE_COUNT) {
+                break;
+            }
+            procedures[value] = pc;
+            definitions--;
+            pc = program->code[pc].jump;
+            continue;
+        }
+
+        if((loop_begin_op == program->code[pc].op && LOOP_GUARD != program->code[pc].arg) ||
+           procedure_call_op == program->code[pc].op || end_op == program->code[pc].op) {
+            break;
+        }
+
+        known_apply(&known, &program->code[pc], engine);
+    }
+
+    /* A procedure is defined elsewhere: the numbers are not static */
+    if(definitions) {
+        free(procedures);
+        free(moved);
+        free(loops);
+        return 0;
+    }
+
+    known_reset(&known, 1);
+    saved = known;
+    for(pc = 0; pc < program->size; pc++) {
+        instruction = program->code[pc];
+        position = program->positions ? &program->positions[pc] : NULL;
+
+        if(procedure_call_op == instruction.op && known_get(&known, known.pointer, &value) &&
+           value >= 0 && value < PROCEDURE_COUNT && procedures[value] >= 0) {
+            target = procedures[value];
+            end = program->code[target].jump;
+
+            for(i = target + 1; i < end && procedure_begin_op != program->code[i].op &&
+                                procedure_call_op != program->code[i].op; i++) {
+            }
+
+            /* Small and calling no procedure (so not recursive): inlined */
+            if(i == end && end - target - 1 <= PROCEDURE_INLINE_SIZE) {
+                for(i = target + 1; i < end; i++) {
+                    if(loop_begin_op == program->code[i].op) {
+                        loops[++loops_index] = optimized.size;
+                    }
+
+                    if(emit_instruction(&optimized, &program->code[i],
+                                        program->positions ? &program->positions[i] : NULL)) {
+                        goto error;
+                    }
+
+                    if(loop_end_op == program->code[i].op) {
+                        optimized.code[optimized.size - 1].jump = loops[loops_index];
+                        optimized.code[loops[loops_index--]].jump = optimized.size - 1;
+                    }
+
+                    known_apply(&known, &program->code[i], engine);
+                }
+                continue;
+            }
+
+            instruction.op = procedure_direct_call_op;
+            instruction.jump = target;
+        }
+
+        if(loop_begin_op == instruction.op || procedure_begin_op == instruction.op) {
+            loops[++loops_index] = optimized.size;
+        }
+
+        moved[pc] = optimized.size;
+        if(emit_instruction(&optimized, &instruction, position)) {
+            goto error;
+        }
+
+        if(loop_end_op == instruction.op || procedure_end_op == instruction.op) {
+            optimized.code[optimized.size - 1].jump = loops[loops_index];
+            optimized.code[loops[loops_index--]].jump = optimized.size - 1;
+        }
+
+        /* The body is entered by a call, the code after it from the '(' */
+        if(procedure_begin_op == instruction.op) {
+            saved = known;
+            known_reset(&known, 0);
+        }
+        else if(procedure_end_op == instruction.op) {
+            known = saved;
+        }
+        else {
+            known_apply(&known, &instruction, engine);
+        }
+    }
+
+    for(pc = 0; pc < optimized.size; pc++) {
+        if(procedure_direct_call_op == optimized.code[pc].op) {
+            optimized.code[pc].jump = moved[optimized.code[pc].jump];
+        }
+    }
+
+    free(procedures);
+    free(moved);
+    free(loops);
+    optimized.data = program->data;
+    optimized.data_size = program->data_size;
+    optimized.data_capacity = program->data_capacity;
+    program->data = NULL;
+    destroy_program(program);
+    *program = optimized;
+    return 0;
+
+error:
+    free(procedures);
+    free(moved);
+    free(loops);
+    destroy_program(&optimized);
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: optimize_offsets                                                 */
+/* Description: addresses the cells of straight-line code relative to the     */
+/*              cell current at the start of the block and moves once at its  */
+/*              end                                                           */
+/* Parameters: program - optimized program (rewritten in place)               */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: a block ends at a bracket, a scan, a multiply (which reads the       */
+/*       current cell) or a procedure op; the body of a loop returning to     */
+/*       its cell ('>+>++<<-') keeps no move at all; a move before the end    */
+/*       of the program is dropped                                            */
+/* -------------------------------------------------------------------------- */
+int optimize_offsets(program_p program) {
+    program_t optimized;
+    instruction_t instruction;
+    const source_position_t* position = NULL;
+    index_p moved = NULL;
+    index_p loops = NULL;
+    index_t loops_index = -1;
+    index_t pc = 0;
+    long offset = 0;
+
+    (void) memset(&optimized, 0, sizeof(program_t));
+
+    moved = (index_p) malloc((size_t) program->size * sizeof(index_t));
+    loops = (index_p) malloc((size_t) program->size * sizeof(index_t));
+    if(!moved || !loops) {
+        perror("Memory error");
+        goto error;
+    }
+
+    for(pc = 0; pc < program->size; pc++) {
+        instruction = program->code[pc];
+        position = program->positions ? &program->positions[pc] : NULL;
+
+        switch(instruction.op) {
+        case cell_move_op:
+            offset += instruction.arg;
+            continue;
+        case cell_add_op:
+        case cell_clear_op:
+        case cell_set_op:
+        case data_output_op:
+        case data_input_op:
+            instruction.offset += offset;
+            break;
+        case data_write_op:
+        case end_op:
+            break;
+        default:
+            /* End of the block: the pending move is made */
+            if(offset) {
+                instruction.op = cell_move_op;
+                instruction.jump = 0;
+                instruction.arg = offset;
+                instruction.offset = 0;
+                if(emit_instruction(&optimized, &instruction, position)) {
+                    goto error;
+                }
+                instruction = program->code[pc];
+                offset = 0;
+            }
+            break;
+        }
+
+        if(loop_begin_op == instruction.op || procedure_begin_op == instruction.op) {
+            loops[++loops_index] = optimized.size;
+        }
+
+        moved[pc] = optimized.size;
+        if(emit_instruction(&optimized, &instruction, position)) {
+            goto error;
+        }
+
+        if(loop_end_op == instruction.op || procedure_end_op == instruction.op) {
+            optimized.code[optimized.size - 1].jump = loops[loops_index];
+            optimized.code[loops[loops_index--]].jump = optimized.size - 1;
+        }
+    }
+
+    for(pc = 0; pc < optimized.size; pc++) {
+        if(procedure_direct_call_op == optimized.code[pc].op) {
+            optimized.code[pc].jump = moved[optimized.code[pc].jump];
+        }
+    }
+
+    free(moved);
+    free(loops);
+    optimized.data = program->data;
+    optimized.data_size = program->data_size;
+    optimized.data_capacity = program->data_capacity;
+    program->data = NULL;
+    destroy_program(program);
+    *program = optimized;
+    return 0;
+
+error:
+    free(moved);
+    free(loops);
+    destroy_program(&optimized);
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: evaluate_run                                                     */
+/* Description: runs the program at compile time from the start until the     */
+/*              first instruction that needs the run (input, procedures), an  */
+/*              end or a limit                                                */
+/* Parameters: program - compiled program                                     */
+/*             config - options of the language (output conversion)           */
+/*             engine - engine of the selected cell type                      */
+/*             top - top[pc] is set if pc is outside loops and procedures     */
+/*             limit - count of instructions to run at most                   */
+/*             evaluation - state of the evaluation (out)                     */
+/* Return: */
+/* Note: the tape is the first STATIC_CELL_COUNT cells (leaving it stops the  */
+/*       run); the last instruction outside loops and procedures that was     */
+/*       reached is recorded with the steps and the output before it, since   */
+/*       the program can be resumed only there                                */
+/* -------------------------------------------------------------------------- */
+void evaluate_run(const program_t* program, const program_options_t* config,
+                  const cell_engine_t* engine, const unsigned char* top, long limit,
+                  evaluation_p evaluation) {
+    const instruction_t* instruction = NULL;
+    long* cells = evaluation->cells;
+    long pointer = 0;
+    long target = 0;
+    long value = 0;
+    index_t pc = 0;
+    int ch = 0;
+
+    (void) memset(cells, 0, STATIC_CELL_COUNT * sizeof(long));
+    evaluation->output_size = 0;
+    evaluation->resume = 0;
+    evaluation->resume_steps = 0;
+    evaluation->resume_output = 0;
+
+    for(evaluation->steps = 0; evaluation->steps < limit; evaluation->steps++, pc++) {
+        instruction = &program->code[pc];
+
+        if(top[pc]) {
+            evaluation->resume = pc;
+            evaluation->resume_steps = evaluation->steps;
+            evaluation->resume_output = evaluation->output_size;
+        }
+
+        /* The cell addressed by the instruction */
+        if(data_write_op != instruction->op &&
+           (instruction->offset < -pointer || instruction->offset >= STATIC_CELL_COUNT - pointer)) {
+            goto stop;
+        }
+        target = pointer + instruction->offset;
+
+        switch(instruction->op) {
+        case cell_add_op:
+            value = (long) ((unsigned long) cells[target] + (unsigned long) instruction->arg);
+            cells[target] = known_wrap(value, engine);
+            break;
+        case cell_move_op:
+            if(instruction->arg < -pointer || instruction->arg >= STATIC_CELL_COUNT - pointer) {
+                goto stop;
+            }
+            pointer += instruction->arg;
+            break;
+        case cell_clear_op:
+            cells[target] = 0;
+            break;
+        case cell_set_op:
+        case cell_muladd_op:
+            value = (cell_set_op == instruction->op) ? instruction->arg :
+                    (long) ((unsigned long) cells[target] +
+                            (unsigned long) cells[pointer] * (unsigned long) instruction->arg);
+            cells[target] = known_wrap(value, engine);
+            break;
+        case cell_scan_op:
+            for(target = pointer; cells[target]; target += instruction->arg) {
+                if(instruction->arg < -target || instruction->arg >= STATIC_CELL_COUNT - target) {
+                    goto stop;
+                }
+            }
+            pointer = target;
+            break;
+        case data_output_op:
+        case data_write_op:
+            value = (data_write_op == instruction->op) ? instruction->arg : 2;
+            if(value > EVALUATE_OUTPUT_LIMIT - evaluation->output_size) {
+                goto stop;
+            }
+
+            if(data_write_op == instruction->op) {
+                (void) memcpy(evaluation->output + evaluation->output_size,
+                              program->data + instruction->offset, (size_t) instruction->arg);
+                evaluation->output_size += instruction->arg;
+                break;
+            }
+
+            /* As data_output */
+            if(config->use_mod255) {
+                ch = (int) (cells[target] % 256);
+                if(ch < 0) {
+                    ch += 256;
+                }
+            }
+            else {
+                ch = (unsigned char) cells[target];
+            }
+            if(config->use_force_rn && '\n' == ch) {
+                evaluation->output[evaluation->output_size++] = '\r';
+            }
+            evaluation->output[evaluation->output_size++] = (unsigned char) ch;
+            break;
+        case loop_begin_op:
+            if(!cells[pointer]) {
+                pc = instruction->jump;
+            }
+            break;
+        case loop_end_op:
+            if(cells[pointer]) {
+                pc = instruction->jump;
+            }
+            break;
+        default:
+            /* end_op, input and procedures */
+            goto stop;
+        }
+    }
+
+stop:
+    evaluation->pc = pc;
+    evaluation->pointer = pointer;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: evaluate_prefix                                                  */
+/* Description: replaces the part of the program that does not depend on the  */
+/*              input with its output and the tape it leaves                  */
+/* Parameters: program - optimized program (rewritten in place)               */
+/*             config - options of the language                               */
+/*             engine - engine of the selected cell type                      */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the program is run until the first input or procedure, the end, or   */
+/*       EVALUATE_STEP_BUDGET instructions; everything before the last        */
+/*       instruction reached outside loops and procedures becomes one         */
+/*       data_write_op, cell_set_op for the non-zero cells and a move to the  */
+/*       current cell; not done with --profile (the counts would change),    */
+/*       --verbose or --trace (the steps would not be traced) nor with        */
+/*       --max-steps (the steps would not be charged)                         */
+/* -------------------------------------------------------------------------- */
+int evaluate_prefix(program_p program, const program_options_t* config,
+                    const cell_engine_t* engine) {
+    program_t evaluated;
+    instruction_t instruction;
+    evaluation_p evaluation = NULL;
+    unsigned char* top = NULL;
+    opcode_t op = end_op;
+    index_t depth = 0;
+    index_t resume = 0;
+    index_t pc = 0;
+    long i = 0;
+
+    if(program->positions || config->verbose || config->trace_filename[0] ||
+       config->max_steps) {
+        return 0;
+    }
+
+    (void) memset(&evaluated, 0, sizeof(program_t));
+
+    evaluation = (evaluation_p) malloc(sizeof(evaluation_t));
+    top = (unsigned char*) malloc((size_t) program->size);
+    if(!evaluation || !top) {
+        perror("Memory error");
+        goto error;
+    }
+
+    evaluation->output = (unsigned char*) malloc(EVALUATE_OUTPUT_LIMIT);
+    if(!evaluation->output) {
+        perror("Memory error");
+        goto error;
+    }
+
+    for(pc = 0; pc < program->size; pc++) {
+        top[pc] = (unsigned char) !depth;
+        if(loop_begin_op == program->code[pc].op || procedure_begin_op == program->code[pc].op) {
+            depth++;
+        }
+        else if(loop_end_op == program->code[pc].op || procedure_end_op == program->code[pc].op) {
+            depth--;
+        }
+    }
+
+    evaluate_run(program, config, engine, top, EVALUATE_STEP_BUDGET, evaluation);
+
+    resume = evaluation->resume;
+    if(!resume) {
+        goto done;
+    }
+
+    /* The state at the resume point (the run went on into a loop) */
+    if(evaluation->resume_steps != evaluation->steps) {
+        evaluate_run(program, config, engine, top, evaluation->resume_steps, evaluation);
+    }
+
+    /* Jumps into the evaluated part (direct calls) cannot be kept */
+    for(pc = resume; pc < program->size; pc++) {
+        op = program->code[pc].op;
+        if((loop_begin_op == op || loop_end_op == op || procedure_begin_op == op ||
+            procedure_end_op == op || procedure_direct_call_op == op) &&
+           program->code[pc].jump < resume) {
+            goto done;
+        }
+    }
+
+    evaluated.data = program->data;
+    evaluated.data_size = program->data_size;
+    evaluated.data_capacity = program->data_capacity;
+    program->data = NULL;
+
+    instruction.jump = 0;
+    instruction.arg = 0;
+    instruction.offset = 0;
+
+    if(evaluation->output_size) {
+        if(emit_data(&evaluated, evaluation->output, (size_t) evaluation->output_size,
+                     &instruction) ||
+           emit_instruction(&evaluated, &instruction, NULL)) {
+            goto error;
+        }
+    }
+
+    /* The tape is not needed at the end of the program */
+    if(end_op != program->code[resume].op) {
+        instruction.op = cell_set_op;
+        for(i = 0; i < STATIC_CELL_COUNT; i++) {
+            if(evaluation->cells[i]) {
+                instruction.arg = evaluation->cells[i];
+                instruction.offset = i;
+                if(emit_instruction(&evaluated, &instruction, NULL)) {
+                    goto error;
+                }
+            }
+        }
+
+        if(evaluation->pointer) {
+            instruction.op = cell_move_op;
+            instruction.arg = evaluation->pointer;
+            instruction.offset = 0;
+            if(emit_instruction(&evaluated, &instruction, NULL)) {
+                goto error;
+            }
+        }
+    }
+
+    depth = evaluated.size - resume;
+    for(pc = resume; pc < program->size; pc++) {
+        instruction = program->code[pc];
+        op = instruction.op;
+        if(loop_begin_op == op || loop_end_op == op || procedure_begin_op == op ||
+           procedure_end_op == op || procedure_direct_call_op == op) {
+            instruction.jump += depth;
+        }
+        if(emit_instruction(&evaluated, &instruction, NULL)) {
+            goto error;
+        }
+    }
+
+    destroy_program(program);
+    *program = evaluated;
+
+done:
+    free(evaluation->output);
+    free(evaluation);
+    free(top);
+    return 0;
+
+error:
+    if(evaluation) {
+        free(evaluation->output);
+    }
+    free(evaluation);
+    free(top);
+    destroy_program(&evaluated);
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: tape_range_use                                                   */
+/* Description: adds a cell used by an instruction to the range               */
+/* Parameters: range - range of the current part of the program               */
+/*             offset - cell relative to the current cell                     */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void tape_range_use(tape_range_p range, long offset) {
+    long cell = range->pointer + offset;
+
+    if(!range->is_used) {
+        range->lo = cell;
+        range->hi = cell;
+        range->is_used = 1;
+    }
+    else if(cell < range->lo) {
+        range->lo = cell;
+    }
+    else if(cell > range->hi) {
+        range->hi = cell;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: tape_range_close                                                 */
+/* Description: records the check of a finished range                         */
+/* Parameters: range - range                                                  */
+/*             checks - checks by slot (see insert_tape_checks)               */
+/* Return: */
+/* Note: no check is needed if no cell is used or the cells of an absolute    */
+/*       range are on the tape                                                */
+/* -------------------------------------------------------------------------- */
+void tape_range_close(const tape_range_t* range, tape_range_p checks) {
+    tape_range_p check = &checks[range->check];
+
+    if(!range->is_used ||
+       (range->is_absolute && range->base + range->lo >= 0 &&
+        range->base + range->hi < STATIC_CELL_COUNT)) {
+        return;
+    }
+
+    if(!check->is_used) {
+        *check = *range;
+    }
+    else {
+        check->lo = range->lo < check->lo ? range->lo : check->lo;
+        check->hi = range->hi > check->hi ? range->hi : check->hi;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: insert_tape_checks                                               */
+/* Description: adds the bounds checks of use_safe_tape where the cells used  */
+/*              are not proven to be on the tape                              */
+/* Parameters: program - optimized program (rewritten in place)               */
+/*             config - options of the language                               */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: one cell_check_op checks all the cells of a block up to the next     */
+/*       loop that moves, scan or call; a loop with zero net movement (and    */
+/*       such loops only inside) gets one loop_check_op before its '[' for    */
+/*       all its iterations, and none if its cells are known from the start   */
+/*       of the program; an access reached only after such a loop is checked  */
+/*       before it; scans become checked loops; the guarded infinite tape     */
+/*       and the sparse tape need no checks                                   */
+/* -------------------------------------------------------------------------- */
+int insert_tape_checks(program_p program, const program_options_t* config) {
+    program_t checked;
+    instruction_t instruction;
+    instruction_t scan[4];
+    const source_position_t* position = NULL;
+    tape_range_p ranges = NULL;
+    tape_range_p range = NULL;
+    tape_range_p checks = NULL;
+    unsigned char* balanced = NULL;
+    long* moves = NULL;
+    index_p moved = NULL;
+    index_p loops = NULL;
+    index_t loops_index = -1;
+    index_t begin = 0;
+    index_t pc = 0;
+    opcode_t op = end_op;
+    int i = 0;
+
+    if(!config->use_safe_tape || config->use_sparse_cells) {
+        return 0;
+    }
+
+#if defined(USE_GUARDED_TAPE)
+    if(config->use_infinite_cells) {
+        return 0;
+    }
+#endif /* defined(USE_GUARDED_TAPE) */
+
+    (void) memset(&checked, 0, sizeof(program_t));
+    (void) memset(scan, 0, sizeof(scan));
+
+    ranges = (tape_range_p) malloc(((size_t) program->size + 1) * sizeof(tape_range_t));
+    checks = (tape_range_p) calloc(2 * (size_t) program->size, sizeof(tape_range_t));
+    balanced = (unsigned char*) calloc((size_t) program->size, 1);
+    moves = (long*) malloc((size_t) program->size * sizeof(long));
+    moved = (index_p) malloc((size_t) program->size * sizeof(index_t));
+    loops = (index_p) malloc((size_t) program->size * sizeof(index_t));
+    if(!ranges || !checks || !balanced || !moves || !moved || !loops) {
+        perror("Memory error");
+        goto error;
+    }
+
+    /* Loops that return to their cell after each iteration */
+    for(pc = 0; pc < program->size; pc++) {
+        op = program->code[pc].op;
+
+        if(loop_begin_op == op || procedure_begin_op == op) {
+            loops[++loops_index] = pc;
+            moves[loops_index] = 0;
+            balanced[pc] = (loop_begin_op == op);
+        }
+        else if(loops_index < 0) {
+            continue;
+        }
+        else if(cell_move_op == op) {
+            moves[loops_index] += program->code[pc].arg;
+        }
+        else if(cell_scan_op == op || procedure_call_op == op ||
+                procedure_direct_call_op == op) {
+            balanced[loops[loops_index]] = 0;
+        }
+        else if(loop_end_op == op || procedure_end_op == op) {
+            begin = loops[loops_index];
+            if(moves[loops_index--]) {
+                balanced[begin] = 0;
+            }
+            if(loops_index >= 0 && !balanced[begin]) {
+                balanced[loops[loops_index]] = 0;
+            }
+        }
+    }
+
+    /* Cells used by each range: the program, loop bodies and procedures */
+    range = ranges;
+    (void) memset(range, 0, sizeof(tape_range_t));
+    range->is_absolute = 1;
+
+    for(pc = 0; pc < program->size; pc++) {
+        instruction = program->code[pc];
+
+        switch(instruction.op) {
+        case cell_move_op:
+            range->pointer += instruction.arg;
+            break;
+        case cell_add_op:
+        case cell_clear_op:
+        case cell_set_op:
+        case data_output_op:
+        case data_input_op:
+            tape_range_use(range, instruction.offset);
+            break;
+        case cell_muladd_op:
+            /* In the body of its LOOP_GUARD loop: checked when the loop  */
+            /* cell is not zero, as the original loop used it             */
+            tape_range_use(range, 0);
+            tape_range_use(range, instruction.offset);
+            break;
+        case loop_begin_op:
+        case procedure_begin_op:
+            tape_range_use(range, 0);
+            (void) memset(range + 1, 0, sizeof(tape_range_t));
+            if(balanced[pc]) {
+                range[1].check = 2 * pc + 1;
+                range[1].base = range->base + range->pointer;
+                range[1].is_absolute = range->is_absolute;
+            }
+            else {
+                range[1].check = 2 * (pc + 1);
+            }
+            range++;
+            break;
+        case loop_end_op:
+        case procedure_end_op:
+            if(loop_end_op == instruction.op) {
+                tape_range_use(range, 0);
+            }
+            tape_range_close(range--, checks);
+            if(loop_end_op != instruction.op || balanced[instruction.jump]) {
+                break;
+            }
+            /* The loop moved the current cell by an unknown count */
+            tape_range_close(range, checks);
+            (void) memset(range, 0, sizeof(tape_range_t));
+            range->check = 2 * (pc + 1);
+            break;
+        case cell_scan_op:
+        case procedure_call_op:
+        case procedure_direct_call_op:
+            tape_range_use(range, 0);
+            tape_range_close(range, checks);
+            (void) memset(range, 0, sizeof(tape_range_t));
+            range->check = 2 * (pc + 1);
+            break;
+        case end_op:
+            tape_range_close(range, checks);
+            break;
+        default:
+            break;
+        }
+    }
+
+    /* Checks before the instructions; scans step through the tape */
+    loops_index = -1;
+    for(pc = 0; pc < program->size; pc++) {
+        position = program->positions ? &program->positions[pc] : NULL;
+
+        for(i = 0; i < 2; i++) {
+            if(checks[2 * pc + i].is_used) {
+                instruction.op = i ? loop_check_op : cell_check_op;
+                instruction.jump = 0;
+                instruction.arg = checks[2 * pc + i].hi;
+                instruction.offset = checks[2 * pc + i].lo;
+                if(emit_instruction(&checked, &instruction, position)) {
+                    goto error;
+                }
+            }
+        }
+
+        instruction = program->code[pc];
+        moved[pc] = checked.size;
+
+        if(cell_scan_op == instruction.op) {
+            /* [ check the next cell, move ] */
+            begin = checked.size;
+            scan[0].op = loop_begin_op;
+            scan[0].jump = begin + 3;
+            scan[1].op = cell_check_op;
+            scan[1].arg = instruction.arg;
+            scan[1].offset = instruction.arg;
+            scan[2].op = cell_move_op;
+            scan[2].arg = instruction.arg;
+            scan[3].op = loop_end_op;
+            scan[3].jump = begin;
+            for(i = 0; i < 4; i++) {
+                if(emit_instruction(&checked, &scan[i], position)) {
+                    goto error;
+                }
+            }
+            continue;
+        }
+
+        if(loop_begin_op == instruction.op || procedure_begin_op == instruction.op) {
+            loops[++loops_index] = checked.size;
+        }
+
+        if(emit_instruction(&checked, &instruction, position)) {
+            goto error;
+        }
+
+        if(loop_end_op == instruction.op || procedure_end_op == instruction.op) {
+            checked.code[checked.size - 1].jump = loops[loops_index];
+            checked.code[loops[loops_index--]].jump = checked.size - 1;
+        }
+    }
+
+    for(pc = 0; pc < checked.size; pc++) {
+        if(procedure_direct_call_op == checked.code[pc].op) {
+            checked.code[pc].jump = moved[checked.code[pc].jump];
+        }
+    }
+
+    free(ranges);
+    free(checks);
+    free(balanced);
+    free(moves);
+    free(moved);
+    free(loops);
+    checked.data = program->data;
+    checked.data_size = program->data_size;
+    checked.data_capacity = program->data_capacity;
+    program->data = NULL;
+    destroy_program(program);
+    *program = checked;
+    return 0;
+
+error:
+    free(ranges);
+    free(checks);
+    free(balanced);
+    free(moves);
+    free(moved);
+    free(loops);
+    destroy_program(&checked);
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: destroy_program                                                  */
+/* Description: releases the compiled program                                 */
+/* Parameters: program - compiled program                                     */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void destroy_program(program_p program) {
+    if(program->cache) {
+#if defined(USE_POSIX_IO)
+        (void) munmap(program->cache, program->cache_size);
+#endif /* defined(USE_POSIX_IO) */
+        (void) memset(program, 0, sizeof(program_t));
+        return;
+    }
+
+    if(program->code) {
+        free(program->code);
+    }
+
+    if(program->data) {
+        free(program->data);
+    }
+
+    if(program->positions) {
+        free(program->positions);
+    }
+
+    (void) memset(program, 0, sizeof(program_t));
+}
+
+#if defined(USE_POSIX_IO)
+/* -------------------------------------------------------------------------- */
+/* Function: cache_hash                                                       */
+/* Description: continues a 32-bit FNV-1a hash over a block of data           */
+/* Parameters: hash - hash so far (CACHE_HASH_BASIS at the start)             */
+/*             data - data (may be NULL if size is 0)                         */
+/*             size - size of the data                                        */
+/* Return: hash                                                               */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+unsigned long cache_hash(unsigned long hash, const void* data, size_t size) {
+    const unsigned char* byte = (const unsigned char*) data;
+    size_t i = 0;
+
+    for(i = 0; i < size; i++) {
+        hash = ((hash ^ byte[i]) * CACHE_HASH_PRIME) & 0xffffffffUL;
+    }
+
+    return hash;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: cache_prepare                                                    */
+/* Description: builds the expected cache header and the cache file name of   */
+/*              a source compiled with the options                            */
+/* Parameters: config - options (cache_directory is set)                      */
+/*             source - source text                                           */
+/*             size - size of the source in bytes                             */
+/*             header - expected header (out; sizes and checksum are 0)       */
+/*             filename - cache file name (out; MAX_FILE_NAME_LENGTH + 32)    */
+/* Return: */
+/* Note: the key holds every option of the language, including those only    */
+/*       the engines use today, so that folding them into the program later   */
+/*       cannot load a stale file; the file name is the hash of the source    */
+/*       and the key, the header has the full key and two source hashes       */
+/* -------------------------------------------------------------------------- */
+void cache_prepare(const program_options_t* config, const char* source, long size,
+                   cache_header_p header, char* filename) {
+    cache_key_p key = &header->key;
+    unsigned long check = 5381;
+    long i = 0;
+
+    (void) memset(header, 0, sizeof(cache_header_t));
+    (void) memcpy(header->magic, CACHE_MAGIC, sizeof(header->magic));
+    header->version = CACHE_VERSION;
+    header->layout = ((unsigned long) sizeof(long) << 16) |
+                     ((unsigned long) sizeof(instruction_t) << 8) |
+                     (unsigned long) sizeof(source_position_t);
+    header->source_hash = cache_hash(CACHE_HASH_BASIS, source, (size_t) size);
+    for(i = 0; i < size; i++) {
+        check = (check * 33 + (unsigned char) source[i]) & 0xffffffffUL;
+    }
+    header->source_check = check;
+    header->source_size = (unsigned long) size;
+
+    key->comment = config->comment.use_comment;
+    key->flags = (config->use_infinite_cells ? 0x001UL : 0) |
+                 (config->use_infinite_nested_loops ? 0x002UL : 0) |
+                 (config->use_negative_value ? 0x004UL : 0) |
+                 (config->use_large_cell_size ? 0x008UL : 0) |
+                 (config->use_fast_input ? 0x010UL : 0) |
+                 (config->use_procedure ? 0x020UL : 0) |
+                 (config->use_symbol_equal ? 0x040UL : 0) |
+                 (config->use_symbol_under ? 0x080UL : 0) |
+                 (config->use_syntax_hq9plus ? 0x100UL : 0) |
+                 (config->use_mod255 ? 0x200UL : 0) |
+                 (config->use_force_rn ? 0x400UL : 0) |
+                 (config->profile ? 0x800UL : 0) |
+                 (config->use_safe_tape ? 0x1000UL : 0) |
+                 (config->use_sparse_cells ? 0x2000UL : 0) |
+                 (config->max_steps ? 0x4000UL : 0) |
+                 (config->verbose || config->trace_filename[0] ? 0x8000UL : 0);
+    key->cell_size = config->use_large_cell_size ? config->cell_size : CHAR_BIT;
+    key->eof_value = config->eof_value;
+
+    (void) sprintf(filename, "%s/%08lx%s", config->cache_directory,
+                   cache_hash(header->source_hash, key, sizeof(cache_key_t)), CACHE_SUFFIX);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: cache_check_code                                                 */
+/* Description: checks the instructions of a cache file                       */
+/* Parameters: code - instructions                                            */
+/*             size - count of instructions                                   */
+/*             data_size - size of the data                                   */
+/* Return: 0 - the engines can run them; -1 - corrupt                         */
+/* Note: the checksum catches damage, this catches files it cannot (written   */
+/*       by another build with the same layout)                               */
+/* -------------------------------------------------------------------------- */
+int cache_check_code(const instruction_t* code, unsigned long size,
+                     unsigned long data_size) {
+    opcode_t pair = end_op;
+    unsigned long pc = 0;
+    unsigned long jump = 0;
+
+    if(!size || end_op != code[size - 1].op) {
+        return -1;
+    }
+
+    for(pc = 0; pc < size; pc++) {
+        if((unsigned int) code[pc].op > (unsigned int) loop_check_op) {
+            return -1;
+        }
+
+        jump = (unsigned long) code[pc].jump;
+        switch(code[pc].op) {
+        case loop_begin_op:
+        case procedure_begin_op:
+            pair = (loop_begin_op == code[pc].op) ? loop_end_op : procedure_end_op;
+            break;
+        case loop_end_op:
+            pair = loop_begin_op;
+            break;
+        case procedure_end_op:
+            pair = procedure_begin_op;
+            break;
+        case procedure_direct_call_op:
+            if(code[pc].jump < 0 || jump >= size || procedure_begin_op != code[jump].op) {
+                return -1;
+            }
+            continue;
+        case data_write_op:
+            if(code[pc].offset < 0 || code[pc].arg < 0 ||
+               (unsigned long) code[pc].offset > data_size ||
+               (unsigned long) code[pc].arg > data_size - (unsigned long) code[pc].offset) {
+                return -1;
+            }
+            continue;
+        default:
+            continue;
+        }
+
+        if(code[pc].jump < 0 || jump >= size || (unsigned long) code[jump].jump != pc ||
+           (pair == loop_end_op || pair == procedure_end_op) != (jump > pc) ||
+           code[jump].op != pair) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: cache_load                                                       */
+/* Description: maps a cache file as the compiled program                     */
+/* Parameters: filename - cache file name                                     */
+/*             expected - expected header (see cache_prepare)                 */
+/*             program - compiled program (out)                               */
+/* Return: 0 - loaded; -1 - missing, stale or corrupt                         */
+/* Note: the arrays of the program point into the read-only mapping, which    */
+/*       destroy_program unmaps; nothing is parsed                            */
+/* -------------------------------------------------------------------------- */
+int cache_load(const char* filename, const cache_header_t* expected, program_p program) {
+    const cache_header_t* header = NULL;
+    const unsigned char* payload = NULL;
+    struct stat status;
+    void* memory = NULL;
+    size_t size = 0;
+    size_t code_bytes = 0;
+    size_t position_bytes = 0;
+    int fd = -1;
+
+    fd = open(filename, O_RDONLY);
+    if(fd < 0) {
+        return -1;
+    }
+
+    if(fstat(fd, &status) || (size_t) status.st_size < sizeof(cache_header_t)) {
+        (void) close(fd);
+        return -1;
+    }
+
+    size = (size_t) status.st_size;
+    memory = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    (void) close(fd);
+    if(MAP_FAILED == memory) {
+        return -1;
+    }
+
+    header = (const cache_header_t*) memory;
+    payload = (const unsigned char*) memory + sizeof(cache_header_t);
+
+    if(memcmp(header->magic, expected->magic, sizeof(header->magic)) ||
+       header->version != expected->version ||
+       header->layout != expected->layout ||
+       header->source_hash != expected->source_hash ||
+       header->source_check != expected->source_check ||
+       header->source_size != expected->source_size ||
+       memcmp(&header->key, &expected->key, sizeof(cache_key_t)) ||
+       header->code_size > (unsigned long) INT_MAX ||
+       header->code_size > size / sizeof(instruction_t) ||
+       (header->position_count && header->position_count != header->code_size) ||
+       header->data_size > size) {
+        goto stale;
+    }
+
+    code_bytes = (size_t) header->code_size * sizeof(instruction_t);
+    position_bytes = (size_t) header->position_count * sizeof(source_position_t);
+
+    if(sizeof(cache_header_t) + code_bytes + position_bytes + header->data_size != size ||
+       cache_hash(CACHE_HASH_BASIS, payload, size - sizeof(cache_header_t)) != header->checksum ||
+       cache_check_code((const instruction_t*) payload, header->code_size, header->data_size)) {
+        goto stale;
+    }
+
+    (void) memset(program, 0, sizeof(program_t));
+    program->code = (instruction_p) payload;
+    program->size = (index_t) header->code_size;
+    program->capacity = program->size;
+    program->positions = header->position_count ?
+                         (source_position_p) (payload + code_bytes) : NULL;
+    program->data = header->data_size ?
+                    (unsigned char*) (payload + code_bytes + position_bytes) : NULL;
+    program->data_size = (long) header->data_size;
+    program->data_capacity = program->data_size;
+    program->cache = memory;
+    program->cache_size = size;
+
+    return 0;
+
+stale:
+    (void) munmap(memory, size);
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: cache_store                                                      */
+/* Description: writes the compiled program to a cache file                   */
+/* Parameters: filename - cache file name                                     */
+/*             expected - header of the file (see cache_prepare)              */
+/*             program - compiled program                                     */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: written to a temporary file and renamed, so readers never see a      */
+/*       partial file; failures are not reported (the cache is optional)     */
+/* -------------------------------------------------------------------------- */
+int cache_store(const char* filename, const cache_header_t* expected,
+                const program_t* program) {
+    cache_header_t header = *expected;
+    char temporary[MAX_FILE_NAME_LENGTH + 40];
+    size_t code_bytes = (size_t) program->size * sizeof(instruction_t);
+    size_t position_bytes = program->positions ?
+                            (size_t) program->size * sizeof(source_position_t) : 0;
+    size_t data_size = (size_t) program->data_size;
+    FILE* file = NULL;
+    int result = 0;
+    int fd = -1;
+
+    header.code_size = (unsigned long) program->size;
+    header.position_count = program->positions ? (unsigned long) program->size : 0;
+    header.data_size = (unsigned long) data_size;
+    header.checksum = cache_hash(cache_hash(cache_hash(CACHE_HASH_BASIS, program->code, code_bytes),
+                                            program->positions, position_bytes),
+                                 program->data, data_size);
+
+    (void) sprintf(temporary, "%s.XXXXXX", filename);
+    fd = mkstemp(temporary);
+    if(fd < 0) {
+        return -1;
+    }
+
+    file = fdopen(fd, "wb");
+    if(!file) {
+        (void) close(fd);
+        (void) remove(temporary);
+        return -1;
+    }
+
+    if(fwrite(&header, sizeof(cache_header_t), 1, file) != 1 ||
+       fwrite(program->code, 1, code_bytes, file) != code_bytes ||
+       fwrite(program->positions, 1, position_bytes, file) != position_bytes ||
+       fwrite(program->data, 1, data_size, file) != data_size) {
+        result = -1;
+    }
+
+    if(fclose(file)) {
+        result = -1;
+    }
+
+    if(result || rename(temporary, filename)) {
+        (void) remove(temporary);
+        return -1;
+    }
+
+    return 0;
+}
+#endif /* defined(USE_POSIX_IO) */
+
+/* ************************************************************************** */
+/* ENGINES (one per cell type)                                                */
+/* ************************************************************************** */
+#define ENGINE_CELL   signed char
+#define ENGINE_SUFFIX s8
+#include "bf+_engine.h"
+
+#define ENGINE_CELL   unsigned char
+#define ENGINE_SUFFIX u8
+#include "bf+_engine.h"
+
+#define ENGINE_CELL   signed short
+#define ENGINE_SUFFIX s16
+#include "bf+_engine.h"
+
+#define ENGINE_CELL   unsigned short
+#define ENGINE_SUFFIX u16
+#include "bf+_engine.h"
+
+#define ENGINE_CELL   signed int
+#define ENGINE_SUFFIX s32
+#include "bf+_engine.h"
+
+#define ENGINE_CELL   unsigned int
+#define ENGINE_SUFFIX u32
+#include "bf+_engine.h"
+
+#define ENGINE_CELL   signed long
+#define ENGINE_SUFFIX s64
+#include "bf+_engine.h"
+
+#define ENGINE_CELL   unsigned long
+#define ENGINE_SUFFIX u64
+#include "bf+_engine.h"
+
+/* -------------------------------------------------------------------------- */
+/* Function: select_cell_engine                                               */
+/* Description: selects the engine of the configured cell type                */
+/* Parameters: config - options                                               */
+/* Return: engine or NULL (no such cell type)                                 */
+/* Note: 8-bit cells without use_large_cell_size, otherwise cell_size bits;   */
+/*       signed cells with use_negative_value; a 64-bit cell is a long        */
+/* -------------------------------------------------------------------------- */
+const cell_engine_t* select_cell_engine(const program_options_t* config) {
+#define CELL_ENGINE(type, suffix, is_signed) \
+    { sizeof(type) * CHAR_BIT, is_signed, #type, \
+      run_program_##suffix, run_program_threaded_##suffix, run_program_sparse_##suffix, \
+      scan_cells_##suffix, \
+      jit_data_output_##suffix, jit_data_input_##suffix }
+    static const cell_engine_t engines[] = {
+        CELL_ENGINE(signed char, s8, 1),
+        CELL_ENGINE(unsigned char, u8, 0),
+        CELL_ENGINE(signed short, s16, 1),
+        CELL_ENGINE(unsigned short, u16, 0),
+        CELL_ENGINE(signed int, s32, 1),
+        CELL_ENGINE(unsigned int, u32, 0),
+        CELL_ENGINE(signed long, s64, 1),
+        CELL_ENGINE(unsigned long, u64, 0)
+    };
+#undef CELL_ENGINE
+    unsigned int bits = config->use_large_cell_size ? config->cell_size : CHAR_BIT;
+    unsigned char is_signed = config->use_negative_value ? 1 : 0;
+    size_t i = 0;
+
+    for(i = 0; i < sizeof(engines) / sizeof(engines[0]); i++) {
+        if(engines[i].bits == bits && engines[i].is_signed == is_signed) {
+            return &engines[i];
+        }
+    }
+
+    (void) fprintf(stderr, "Unsupported cell size: %u bits\n", bits);
+    return NULL;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: create_tape                                                      */
+/* Description: allocates the tape                                            */
+/* Parameters: tape - tape (out)                                              */
+/*             cell_size - size of a cell in bytes                            */
+/*             is_infinite - use_infinite_cells                               */
+/*             is_sparse - use_sparse_cells                                   */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: without use_infinite_cells the tape has STATIC_CELL_COUNT cells;     */
+/*       with it a contiguous range is reserved and cell 0 is placed in its   */
+/*       middle; the accessible part is surrounded by inaccessible guard      */
+/*       pages and grows in either direction when one of them is hit, so      */
+/*       moves never need bounds checks; up to GUARDED_TAPE_SLOTS threads     */
+/*       share the fault handler, each faults on its own tape only; a sparse  */
+/*       tape has only its directory until the cells are used (sparse_page)   */
+/* -------------------------------------------------------------------------- */
+int create_tape(tape_p tape, size_t cell_size, int is_infinite, int is_sparse) {
+#if defined(USE_GUARDED_TAPE)
+    struct sigaction action;
+    void* memory = NULL;
+    int slot = 0;
+    int result = 0;
+#endif /* defined(USE_GUARDED_TAPE) */
+
+    (void) memset(tape, 0, sizeof(tape_t));
+    tape->cell_size = cell_size;
+
+    if(is_sparse) {
+        tape->directory_size = SPARSE_DIRECTORY_SIZE;
+        tape->pages = (void**) calloc(tape->directory_size, sizeof(void*));
+        tape->numbers = (unsigned long*) calloc(tape->directory_size, sizeof(unsigned long));
+        if(!tape->pages || !tape->numbers) {
+            perror("Memory error");
+            free(tape->pages);
+            free(tape->numbers);
+            return -1;
+        }
+        return 0;
+    }
+
+#if defined(USE_GUARDED_TAPE)
+    if(is_infinite) {
+        tape->page_size = (size_t) sysconf(_SC_PAGESIZE);
+        tape->reserve_size = GUARDED_TAPE_RESERVE_SIZE;
+
+        memory = mmap(NULL, tape->reserve_size, PROT_NONE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if(MAP_FAILED == memory) {
+            perror("Memory error");
+            return -1;
+        }
+
+        tape->reserve = (unsigned char*) memory;
+        tape->begin = tape->reserve + tape->reserve_size / 2 - GUARDED_TAPE_INITIAL_SIZE / 2;
+        tape->end = tape->begin + GUARDED_TAPE_INITIAL_SIZE;
+        tape->cells = tape->reserve + tape->reserve_size / 2;
+
+        if(mprotect(tape->begin, GUARDED_TAPE_INITIAL_SIZE, PROT_READ | PROT_WRITE)) {
+            perror("Memory error");
+            (void) munmap(tape->reserve, tape->reserve_size);
+            return -1;
+        }
+
+        (void) memset(&action, 0, sizeof(action));
+        action.sa_sigaction = tape_fault_handler;
+        action.sa_flags = SA_SIGINFO;
+        (void) sigemptyset(&action.sa_mask);
+
+#if defined(USE_THREADS)
+        (void) pthread_mutex_lock(&guarded_tape_lock);
+#endif /* defined(USE_THREADS) */
+        for(slot = 0; slot < GUARDED_TAPE_SLOTS && guarded_tapes[slot]; slot++) {
+        }
+
+        if(GUARDED_TAPE_SLOTS == slot) {
+            (void) fprintf(stderr, "Tape error: more than %d infinite tapes\n", GUARDED_TAPE_SLOTS);
+            result = -1;
+        }
+        else if(!guarded_tape_count &&
+                (sigaction(SIGSEGV, &action, &guarded_tape_old_segv) ||
+                 sigaction(SIGBUS, &action, &guarded_tape_old_bus))) {
+            perror("Signal error");
+            result = -1;
+        }
+        else {
+            guarded_tapes[slot] = tape;
+            guarded_tape_count++;
+        }
+#if defined(USE_THREADS)
+        (void) pthread_mutex_unlock(&guarded_tape_lock);
+#endif /* defined(USE_THREADS) */
+
+        if(result) {
+            (void) munmap(tape->reserve, tape->reserve_size);
+        }
+
+        return result;
+    }
+#endif /* defined(USE_GUARDED_TAPE) */
+
+    tape->cells = calloc(STATIC_CELL_COUNT, cell_size);
+    if(!tape->cells) {
+        perror("Memory error");
+        return -1;
+    }
+
+    tape->begin = (unsigned char*) tape->cells;
+    tape->end = tape->begin + STATIC_CELL_COUNT * cell_size;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: destroy_tape                                                     */
+/* Description: releases the tape                                             */
+/* Parameters: tape - tape                                                    */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void destroy_tape(tape_p tape) {
+#if defined(USE_GUARDED_TAPE)
+    int slot = 0;
+#endif /* defined(USE_GUARDED_TAPE) */
+
+    if(tape->pages) {
+        clear_tape(tape);
+        free(tape->pages);
+        free(tape->numbers);
+        free(tape->dirty);
+    }
+#if defined(USE_GUARDED_TAPE)
+    else if(tape->reserve) {
+#if defined(USE_THREADS)
+        (void) pthread_mutex_lock(&guarded_tape_lock);
+#endif /* defined(USE_THREADS) */
+        for(slot = 0; slot < GUARDED_TAPE_SLOTS; slot++) {
+            if(guarded_tapes[slot] == tape) {
+                guarded_tapes[slot] = NULL;
+                if(!--guarded_tape_count) {
+                    (void) sigaction(SIGSEGV, &guarded_tape_old_segv, NULL);
+                    (void) sigaction(SIGBUS, &guarded_tape_old_bus, NULL);
+                }
+            }
+        }
+#if defined(USE_THREADS)
+        (void) pthread_mutex_unlock(&guarded_tape_lock);
+#endif /* defined(USE_THREADS) */
+        (void) munmap(tape->reserve, tape->reserve_size);
+    }
+    else
+#endif /* defined(USE_GUARDED_TAPE) */
+    if(tape->cells) {
+        free(tape->cells);
+    }
+
+    (void) memset(tape, 0, sizeof(tape_t));
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: clear_tape                                                       */
+/* Description: sets all cells to zero for the next program                   */
+/* Parameters: tape - tape                                                    */
+/* Return: */
+/* Note: a grown infinite tape keeps its accessible part; the pages of a      */
+/*       sparse tape are released                                             */
+/* -------------------------------------------------------------------------- */
+void clear_tape(tape_p tape) {
+    size_t i = 0;
+
+    if(!tape->pages) {
+        (void) memset(tape->begin, 0, (size_t) (tape->end - tape->begin));
+        return;
+    }
+
+    for(i = 0; i < tape->directory_size; i++) {
+        free(tape->pages[i]);
+        tape->pages[i] = NULL;
+    }
+    tape->page_count = 0;
+    tape->last_page = NULL;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: sparse_page                                                      */
+/* Description: finds a page of the sparse tape, allocated on first use       */
+/* Parameters: tape - sparse tape                                             */
+/*             number - page number (cell index as unsigned long shifted      */
+/*                      right by SPARSE_PAGE_BITS)                            */
+/* Return: SPARSE_PAGE_CELLS cells (zero when allocated) or NULL (no memory)  */
+/* Note: the directory is a hash table with linear probing that doubles when  */
+/*       half full; the page found becomes the one-entry cache the engines    */
+/*       check first (see sparse_cell_<suffix>) and is marked dirty while     */
+/*       snapshots are taken                                                  */
+/* -------------------------------------------------------------------------- */
+void* sparse_page(tape_p tape, unsigned long number) {
+    void** pages = NULL;
+    unsigned long* numbers = NULL;
+    unsigned char* dirty = NULL;
+    size_t mask = tape->directory_size - 1;
+    size_t size = 0;
+    size_t i = 0;
+    size_t j = 0;
+
+    for(i = (size_t) (number * 2654435761UL) & mask; tape->pages[i]; i = (i + 1) & mask) {
+        if(tape->numbers[i] == number) {
+            if(tape->dirty) {
+                tape->dirty[i] = 1;
+            }
+            tape->last_number = number;
+            tape->last_page = tape->pages[i];
+            return tape->last_page;
+        }
+    }
+
+    if(2 * (tape->page_count + 1) > tape->directory_size) {
+        size = 2 * tape->directory_size;
+        pages = (void**) calloc(size, sizeof(void*));
+        numbers = (unsigned long*) calloc(size, sizeof(unsigned long));
+        if(tape->dirty) {
+            dirty = (unsigned char*) calloc(size, 1);
+        }
+        if(!pages || !numbers || (tape->dirty && !dirty)) {
+            perror("Memory error");
+            free(pages);
+            free(numbers);
+            free(dirty);
+            return NULL;
+        }
+
+        for(j = 0; j < tape->directory_size; j++) {
+            if(tape->pages[j]) {
+                for(i = (size_t) (tape->numbers[j] * 2654435761UL) & (size - 1); pages[i];
+                    i = (i + 1) & (size - 1)) {
+                }
+                pages[i] = tape->pages[j];
+                numbers[i] = tape->numbers[j];
+                if(dirty) {
+                    dirty[i] = tape->dirty[j];
+                }
+            }
+        }
+
+        free(tape->pages);
+        free(tape->numbers);
+        free(tape->dirty);
+        tape->pages = pages;
+        tape->numbers = numbers;
+        tape->dirty = dirty;
+        tape->directory_size = size;
+        mask = size - 1;
+
+        for(i = (size_t) (number * 2654435761UL) & mask; tape->pages[i]; i = (i + 1) & mask) {
+        }
+    }
+
+    tape->pages[i] = calloc(SPARSE_PAGE_CELLS, tape->cell_size);
+    if(!tape->pages[i]) {
+        perror("Memory error");
+        return NULL;
+    }
+    tape->numbers[i] = number;
+    tape->page_count++;
+    if(tape->dirty) {
+        tape->dirty[i] = 1;
+    }
+
+    tape->last_number = number;
+    tape->last_page = tape->pages[i];
+    return tape->last_page;
+}
+
+#if defined(USE_GUARDED_TAPE)
+/* -------------------------------------------------------------------------- */
+/* Function: tape_fault_handler                                               */
+/* Description: grows the guarded tape when one of its guard pages is hit     */
+/* Parameters: sig - SIGSEGV or SIGBUS                                        */
+/*             info - fault information                                       */
+/*             context - not used                                             */
+/* Return: */
+/* Note: the accessible part at least doubles; faults outside the reserved    */
+/*       ranges go to the previous handler; the fault is delivered to the     */
+/*       thread that owns the tape, so the tape is not shared                 */
+/* -------------------------------------------------------------------------- */
+void tape_fault_handler(int sig, siginfo_t* info, void* context) {
+    static const char message[] = "Tape error: reserved range of infinite cells exhausted\n";
+    tape_p tape = NULL;
+    unsigned char* address = (unsigned char*) info->si_addr;
+    size_t size = 0;
+    size_t needed = 0;
+    int slot = 0;
+
+    (void) context;
+
+    for(slot = 0; slot < GUARDED_TAPE_SLOTS; slot++) {
+        tape = guarded_tapes[slot];
+        if(tape && address >= tape->reserve && address < tape->reserve + tape->reserve_size) {
+            break;
+        }
+        tape = NULL;
+    }
+
+    if(tape) {
+        size = (size_t) (tape->end - tape->begin);
+
+        if(address >= tape->end) {
+            needed = (size_t) (address - tape->end) / tape->page_size * tape->page_size + tape->page_size;
+            size = needed > size ? needed : size;
+            if(size > (size_t) (tape->reserve + tape->reserve_size - tape->end)) {
+                size = (size_t) (tape->reserve + tape->reserve_size - tape->end);
+            }
+            if(!mprotect(tape->end, size, PROT_READ | PROT_WRITE)) {
+                tape->end += size;
+                return;
+            }
+        }
+        else if(address < tape->begin) {
+            needed = (size_t) (tape->begin - address - 1) / tape->page_size * tape->page_size + tape->page_size;
+            size = needed > size ? needed : size;
+            if(size > (size_t) (tape->begin - tape->reserve)) {
+                size = (size_t) (tape->begin - tape->reserve);
+            }
+            if(!mprotect(tape->begin - size, size, PROT_READ | PROT_WRITE)) {
+                tape->begin -= size;
+                return;
+            }
+        }
+
+        (void) write(STDERR_FILENO, message, sizeof(message) - 1);
+    }
+
+    /* Not a tape fault: the previous handler gets it on the next attempt */
+    (void) sigaction(SIGSEGV, &guarded_tape_old_segv, NULL);
+    (void) sigaction(SIGBUS, &guarded_tape_old_bus, NULL);
+    (void) sig;
+}
+#endif /* defined(USE_GUARDED_TAPE) */
+
+/* -------------------------------------------------------------------------- */
+/* Function: init_context                                                     */
+/* Description: prepares the context of a run                                 */
+/* Parameters: context - context of the run (out)                             */
+/*             config - options of the run                                    */
+/*             input_filename - program input ("" - standard input)           */
+/*             output_filename - program output ("" - standard output)        */
+/* Return: */
+/* Note: the file names are not copied                                        */
+/* -------------------------------------------------------------------------- */
+void init_context(context_p context, const program_options_t* config,
+                  const char* input_filename, const char* output_filename) {
+    (void) memset(context, 0, sizeof(context_t));
+
+    context->options = config;
+    context->input_filename = input_filename;
+    context->output_filename = output_filename;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: output_send                                                      */
+/* Description: writes two blocks to the program output in order             */
+/* Parameters: context - context of the run                                   */
+/*             first - first block                                            */
+/*             first_size - size of the first block                           */
+/*             second - second block (or NULL)                                */
+/*             second_size - size of the second block                         */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: one writev call in the common case; stdio output is flushed first   */
+/*       so messages and program output keep their order; the output          */
+/*       callback of the context gets the blocks one by one; output_count     */
+/*       counts the bytes sent (snapshots); bytes beyond max_output are       */
+/*       dropped and stop the run (see limit_close)                           */
+/* -------------------------------------------------------------------------- */
+int output_send(context_p context, const void* first, size_t first_size,
+                const void* second, size_t second_size) {
+    unsigned long room = context->options->max_output - context->output_count;
+#if defined(USE_WRITEV)
+    struct iovec vector[2];
+    struct iovec* current = vector;
+    int count = 0;
+    ssize_t written = 0;
+#endif /* defined(USE_WRITEV) */
+
+    if(context->options->max_output && first_size + second_size > room) {
+        if(first_size > room) {
+            first_size = (size_t) room;
+        }
+        second_size = (size_t) room - first_size;
+        if(!context->limit) {
+            context->limit = output_limit;
+        }
+    }
+
+    if(context->write) {
+        if((first_size && context->write(context->user, (const unsigned char*) first,
+                                         (unsigned long) first_size)) ||
+           (second_size && context->write(context->user, (const unsigned char*) second,
+                                          (unsigned long) second_size))) {
+            return -1;
+        }
+        context->output_count += (unsigned long) (first_size + second_size);
+        return 0;
+    }
+
+#if defined(USE_WRITEV)
+    (void) fflush(stdout);
+
+    if(first_size) {
+        vector[count].iov_base = (void*) first;
+        vector[count].iov_len = first_size;
+        count++;
+    }
+    if(second_size) {
+        vector[count].iov_base = (void*) second;
+        vector[count].iov_len = second_size;
+        count++;
+    }
+    context->output_count += (unsigned long) (first_size + second_size);
+
+    while(count) {
+        written = writev(context->output.fd, current, count);
+        if(written < 0) {
+            if(EINTR == errno) {
+                continue;
+            }
+            return -1;
+        }
+
+        /* Partial write: skip what has been written */
+        while(count && (size_t) written >= current->iov_len) {
+            written -= (ssize_t) current->iov_len;
+            current++;
+            count--;
+        }
+        if(count) {
+            current->iov_base = (char*) current->iov_base + written;
+            current->iov_len -= (size_t) written;
+        }
+    }
+
+    return 0;
+#else
+    if(fwrite(first, 1, first_size, stdout) != first_size ||
+       (second_size && fwrite(second, 1, second_size, stdout) != second_size)) {
+        return -1;
+    }
+    context->output_count += (unsigned long) (first_size + second_size);
+
+    return fflush(stdout) ? -1 : 0;
+#endif /* defined(USE_WRITEV) */
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: output_open                                                      */
+/* Description: opens output_filename (if any and no output callback is set)  */
+/*              and allocates the output buffer                               */
+/* Parameters: context - context of the run                                   */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the buffer is flushed when output_buffer_size bytes are pending;     */
+/*       in verbose mode after each write                                     */
+/* -------------------------------------------------------------------------- */
+int output_open(context_p context) {
+    (void) memset(&context->output, 0, sizeof(output_buffer_t));
+
+#if defined(USE_WRITEV)
+    context->output.fd = STDOUT_FILENO;
+
+    if(!context->write && context->output_filename[0]) {
+        /* A resumed run keeps the output written before the snapshot */
+        context->output.fd = open(context->output_filename,
+                                  O_WRONLY | O_CREAT |
+                                  (context->options->resume_filename[0] ? 0 : O_TRUNC), 0666);
+        if(context->output.fd < 0) {
+            perror("File not open");
+            return -1;
+        }
+        context->output.is_open = 1;
+    }
+#else
+    if(!context->write && context->output_filename[0]) {
+        if(!freopen(context->output_filename, "wb", stdout)) {
+            perror("File not open");
+            return -1;
+        }
+    }
+#endif /* defined(USE_WRITEV) */
+
+    context->output.threshold = context->options->verbose ? 0 : (size_t) context->options->output_buffer_size;
+    context->output.capacity = context->output.threshold > 2 ? context->output.threshold : 2;
+
+    context->output.data = (unsigned char*) malloc(context->output.capacity);
+    if(!context->output.data) {
+        perror("Memory error");
+        (void) output_close(context);
+        return -1;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: output_flush                                                     */
+/* Description: writes the pending output                                     */
+/* Parameters: context - context of the run                                   */
+/* Return: */
+/* Note: called on input, on exit and when the threshold is reached           */
+/* -------------------------------------------------------------------------- */
+void output_flush(context_p context) {
+    if(context->output.size) {
+        if(!context->output.is_failed &&
+           output_send(context, context->output.data, context->output.size, NULL, 0)) {
+            perror("Output error");
+            context->output.is_failed = 1;
+        }
+        context->output.size = 0;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: output_write                                                     */
+/* Description: appends bytes to the output buffer                            */
+/* Parameters: context - context of the run                                   */
+/*             bytes - data                                                   */
+/*             count - number of bytes                                        */
+/* Return: */
+/* Note: data larger than the free space goes out together with the pending   */
+/*       output in a single call                                              */
+/* -------------------------------------------------------------------------- */
+void output_write(context_p context, const void* bytes, size_t count) {
+    if(context->output.size + count > context->output.capacity) {
+        if(!context->output.is_failed &&
+           output_send(context, context->output.data, context->output.size, bytes, count)) {
+            perror("Output error");
+            context->output.is_failed = 1;
+        }
+        context->output.size = 0;
+        return;
+    }
+
+    (void) memcpy(context->output.data + context->output.size, bytes, count);
+    context->output.size += count;
+
+    if(context->output.size >= context->output.threshold) {
+        output_flush(context);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: output_close                                                     */
+/* Description: flushes and releases the output buffer and closes             */
+/*              output_filename                                               */
+/* Parameters: context - context of the run                                   */
+/* Return: 0 - success; -1 - some output has not been written                 */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int output_close(context_p context) {
+    int result = 0;
+
+    output_flush(context);
+    result = context->output.is_failed ? -1 : 0;
+
+    if(context->output.data) {
+        free(context->output.data);
+    }
+
+#if defined(USE_WRITEV)
+    if(context->output.is_open) {
+        (void) close(context->output.fd);
+    }
+#endif /* defined(USE_WRITEV) */
+
+    (void) memset(&context->output, 0, sizeof(output_buffer_t));
+
+    return result;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: data_output                                                      */
+/* Description: writes the value of a cell as a character                     */
+/* Parameters: context - context of the run                                   */
+/*             value - cell value                                             */
+/* Return: */
+/* Note: use_mod255 and use_force_rn are applied as the character enters     */
+/*       the output buffer                                                    */
+/* -------------------------------------------------------------------------- */
+void data_output(context_p context, cell_t value) {
+    int ch = 0;
+
+    if(context->options->use_mod255) {
+        ch = (int) (value % 256);
+        if(ch < 0) {
+            ch += 256;
+        }
+    }
+    else {
+        ch = (unsigned char) value;
+    }
+
+    if(context->output.size + 2 > context->output.capacity) {
+        output_flush(context);
+    }
+
+    if(context->options->use_force_rn && '\n' == ch) {
+        context->output.data[context->output.size++] = '\r';
+    }
+
+    context->output.data[context->output.size++] = (unsigned char) ch;
+
+    if(context->output.size >= context->output.threshold) {
+        output_flush(context);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: input_open                                                       */
+/* Description: prepares the program input                                    */
+/* Parameters: context - context of the run                                   */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: input_filename (or the standard input) is mapped if it is a regular  */
+/*       file and read in INPUT_BLOCK_SIZE blocks otherwise; with             */
+/*       use_fast_input a terminal is switched to non-canonical mode; input   */
+/*       in memory or from the callback of the context (library) is used as   */
+/*       is                                                                   */
+/* -------------------------------------------------------------------------- */
+int input_open(context_p context) {
+#if defined(USE_POSIX_IO)
+    struct termios terminal;
+    struct stat status;
+    off_t position = 0;
+    void* memory = NULL;
+#endif /* defined(USE_POSIX_IO) */
+
+    (void) memset(&context->input, 0, sizeof(input_buffer_t));
+
+    if(context->input_data) {
+        context->input.data = context->input_data;
+        context->input.size = context->input_size;
+        context->input.is_eof = 1;
+        return 0;
+    }
+
+    if(context->read) {
+        context->input.block = (unsigned char*) malloc(INPUT_BLOCK_SIZE);
+        if(!context->input.block) {
+            perror("Memory error");
+            return -1;
+        }
+        context->input.data = context->input.block;
+        return 0;
+    }
+
+#if defined(USE_POSIX_IO)
+    context->input.fd = STDIN_FILENO;
+
+    if(context->input_filename[0]) {
+        context->input.fd = open(context->input_filename, O_RDONLY);
+        if(context->input.fd < 0) {
+            perror("File not open");
+            return -1;
+        }
+        context->input.is_open = 1;
+    }
+
+    if(!fstat(context->input.fd, &status) && S_ISREG(status.st_mode)) {
+        /* The rest of the file from the current position */
+        position = lseek(context->input.fd, 0, SEEK_CUR);
+
+        if(position < 0 || position > status.st_size) {
+            position = 0;
+        }
+
+        if(status.st_size == position) {
+            context->input.is_eof = 1;
+            return 0;
+        }
+
+        memory = mmap(NULL, (size_t) status.st_size, PROT_READ, MAP_PRIVATE, context->input.fd, 0);
+        if(MAP_FAILED != memory) {
+            context->input.mapping = memory;
+            context->input.mapping_size = (size_t) status.st_size;
+            context->input.data = (const unsigned char*) memory;
+            context->input.size = (size_t) status.st_size;
+            context->input.position = (size_t) position;
+            context->input.is_eof = 1;
+            return 0;
+        }
+    }
+
+    if(context->options->use_fast_input && isatty(context->input.fd) &&
+       !tcgetattr(context->input.fd, &context->input.terminal)) {
+        terminal = context->input.terminal;
+        terminal.c_lflag &= ~((tcflag_t) ICANON);
+        terminal.c_cc[VMIN] = 1;
+        terminal.c_cc[VTIME] = 0;
+
+        if(!tcsetattr(context->input.fd, TCSANOW, &terminal)) {
+            context->input.restore_terminal = 1;
+            (void) signal(SIGINT, signal_handler);
+            (void) signal(SIGTERM, signal_handler);
+            (void) signal(SIGHUP, signal_handler);
+        }
+    }
+
+    context->input.block = (unsigned char*) malloc(INPUT_BLOCK_SIZE);
+    if(!context->input.block) {
+        perror("Memory error");
+        input_close(context);
+        return -1;
+    }
+    context->input.data = context->input.block;
+#else
+    if(context->input_filename[0]) {
+        if(!freopen(context->input_filename, "rb", stdin)) {
+            perror("File not open");
+            return -1;
+        }
+    }
+#endif /* defined(USE_POSIX_IO) */
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: input_fill                                                       */
+/* Description: reads the next block of input                                 */
+/* Parameters: context - context of the run                                   */
+/* Return: 0 - data available; -1 - end of input or a limit reached          */
+/* Note: a terminal or a pipe delivers what is available, up to a block; so   */
+/*       does the input callback of the context; a reached limit interrupts   */
+/*       a blocked read and leaves the input open                             */
+/* -------------------------------------------------------------------------- */
+int input_fill(context_p context) {
+#if defined(USE_POSIX_IO)
+    ssize_t count = 0;
+#endif /* defined(USE_POSIX_IO) */
+    long received = 0;
+
+    if(context->read) {
+        if(!context->input.is_eof) {
+            received = context->read(context->user, context->input.block, INPUT_BLOCK_SIZE);
+            if(received > 0) {
+                context->input.size = (size_t) received;
+                context->input.position = 0;
+                return 0;
+            }
+            context->input.is_eof = 1;
+        }
+        return -1;
+    }
+
+#if defined(USE_POSIX_IO)
+    while(!context->input.is_eof) {
+        /* SIGALRM of a time limit interrupts the read */
+        if(context->limit) {
+            return -1;
+        }
+
+        count = read(context->input.fd, context->input.block, INPUT_BLOCK_SIZE);
+        if(count > 0) {
+            context->input.size = (size_t) count;
+            context->input.position = 0;
+            return 0;
+        }
+
+        if(count < 0 && EINTR == errno) {
+            continue;
+        }
+
+        if(count < 0) {
+            perror("Input error");
+        }
+        context->input.is_eof = 1;
+    }
+#endif /* defined(USE_POSIX_IO) */
+
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: input_close                                                      */
+/* Description: releases the program input and restores the terminal mode     */
+/* Parameters: context - context of the run                                   */
+/* Return: */
+/* Note: safe to call more than once                                          */
+/* -------------------------------------------------------------------------- */
+void input_close(context_p context) {
+#if defined(USE_POSIX_IO)
+    if(context->input.restore_terminal) {
+        (void) tcsetattr(context->input.fd, TCSANOW, &context->input.terminal);
+        context->input.restore_terminal = 0;
+    }
+
+    if(context->input.mapping) {
+        (void) munmap(context->input.mapping, context->input.mapping_size);
+    }
+
+    if(context->input.is_open) {
+        (void) close(context->input.fd);
+    }
+#endif /* defined(USE_POSIX_IO) */
+
+    if(context->input.block) {
+        free(context->input.block);
+    }
+
+    (void) memset(&context->input, 0, sizeof(input_buffer_t));
+}
+
+#if defined(USE_POSIX_IO)
+/* -------------------------------------------------------------------------- */
+/* Function: signal_handler                                                   */
+/* Description: dumps the trace and restores the terminal mode before the     */
+/*              program is terminated                                         */
+/* Parameters: sig - signal                                                   */
+/* Return: */
+/* Note: SIGUSR1 only dumps the trace; other signals are raised again with    */
+/*       the default action; only the run of the main thread is handled       */
+/* -------------------------------------------------------------------------- */
+void signal_handler(int sig) {
+    context_p context = main_context;
+
+    if(context && context->trace.events) {
+        (void) trace_dump(&context->trace, context->options->trace_filename);
+    }
+
+    if(SIGUSR1 == sig) {
+        return;
+    }
+
+    if(context && context->input.restore_terminal) {
+        (void) tcsetattr(context->input.fd, TCSANOW, &context->input.terminal);
+        context->input.restore_terminal = 0;
+    }
+
+    (void) signal(sig, SIG_DFL);
+    (void) raise(sig);
+}
+#endif /* defined(USE_POSIX_IO) */
+
+/* -------------------------------------------------------------------------- */
+/* Function: data_input                                                       */
+/* Description: reads a character for the current cell                       */
+/* Parameters: context - context of the run                                   */
+/*             value - value of the cell (in: current; out: the character or  */
+/*                     the eof_value at the end of input)                     */
+/* Return: 0 - success; -1 - a limit was reached before the input came        */
+/* Note: pending output is flushed before the input may block, so prompts     */
+/*       appear before reading; on failure the cell is left unchanged and    */
+/*       the engines stop with limit_reached                                  */
+/* -------------------------------------------------------------------------- */
+int data_input(context_p context, cell_t* value) {
+    int ch = EOF;
+
+#if !defined(USE_POSIX_IO)
+    if(!context->input.data) {
+        output_flush(context);
+        ch = fgetc(stdin);
+    }
+    else
+#endif /* !defined(USE_POSIX_IO) */
+    {
+        if(context->input.position >= context->input.size) {
+            output_flush(context);
+        }
+
+        if(context->input.position < context->input.size || !input_fill(context)) {
+            ch = context->input.data[context->input.position++];
+        }
+    }
+
+    if(EOF != ch) {
+        context->input_count++;
+        *value = (cell_t) ch;
+        return 0;
+    }
+
+    if(context->limit) {
+        return -1;
+    }
+
+    switch(context->options->eof_value) {
+    case zero_eof:
+        *value = 0;
+        break;
+    case unchanged_eof:
+        break;
+    default:
+        *value = (cell_t) EOF;
+        break;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: data_write                                                       */
+/* Description: executes a data_write_op: writes constant output              */
+/* Parameters: context - context of the run                                   */
+/*             program - compiled program (data)                              */
+/*             instruction - data_write_op                                    */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void data_write(context_p context, const program_t* program, const instruction_t* instruction) {
+    output_write(context, program->data + instruction->offset, (size_t) instruction->arg);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: tape_error                                                       */
+/* Description: reports a failed cell_check_op or loop_check_op               */
+/* Parameters: cell - current cell                                            */
+/*             instruction - check                                            */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void tape_error(long cell, const instruction_t* instruction) {
+    (void) fprintf(stderr, "Tape error: cell %ld is outside the tape (0-%d)\n",
+                   cell + instruction->offset < 0 ? cell + instruction->offset :
+                   cell + instruction->arg, STATIC_CELL_COUNT - 1);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: procedure_open                                                   */
+/* Description: allocates the procedure table and the call stack of a run     */
+/* Parameters: context - context of the run                                   */
+/*             program - compiled program                                     */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: nothing is allocated for a program without procedures; the call      */
+/*       stack has a fixed size (CALL_STACK_SIZE calls)                       */
+/* -------------------------------------------------------------------------- */
+int procedure_open(context_p context, const program_t* program) {
+    index_t pc = 0;
+    index_t i = 0;
+
+    for(pc = 0; pc < program->size && procedure_begin_op != program->code[pc].op &&
+                procedure_call_op != program->code[pc].op; pc++) {
+    }
+
+    if(pc == program->size) {
+        return 0;
+    }
+
+    context->procedures = (index_t*) malloc(PROCEDURE_COUNT * sizeof(index_t));
+    context->calls = (index_t*) malloc(CALL_STACK_SIZE * sizeof(index_t));
+    if(!context->procedures || !context->calls) {
+        perror("Memory error");
+        procedure_close(context);
+        return -1;
+    }
+
+    for(i = 0; i < PROCEDURE_COUNT; i++) {
+        context->procedures[i] = -1;
+    }
+    context->call_depth = 0;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: procedure_define                                                 */
+/* Description: executes a '(': defines the procedure numbered by the cell    */
+/* Parameters: context - context of the run                                   */
+/*             number - value of the current cell                             */
+/*             pc - index of the procedure_begin_op                           */
+/* Return: 0 - success; -1 - number out of range                              */
+/* Note: a procedure may be redefined                                         */
+/* -------------------------------------------------------------------------- */
+int procedure_define(context_p context, cell_t number, index_t pc) {
+    if(number < 0 || number >= PROCEDURE_COUNT) {
+        (void) fprintf(stderr, "Procedure error: number %ld out of range (0-%d)\n",
+                       (long) number, PROCEDURE_COUNT - 1);
+        return -1;
+    }
+
+    context->procedures[number] = pc;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: procedure_call                                                   */
+/* Description: executes a ':': pushes the return address                     */
+/* Parameters: context - context of the run                                   */
+/*             number - value of the current cell (if target < 0)             */
+/*             target - index of the procedure_begin_op (direct call) or -1   */
+/*             pc - index of the call                                         */
+/* Return: index of the procedure_begin_op; -1 - undefined procedure or call  */
+/*         stack overflow                                                     */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+index_t procedure_call(context_p context, cell_t number, index_t target, index_t pc) {
+    if(target < 0) {
+        if(number < 0 || number >= PROCEDURE_COUNT || context->procedures[number] < 0) {
+            (void) fprintf(stderr, "Procedure error: procedure %ld is not defined\n",
+                           (long) number);
+            return -1;
+        }
+        target = context->procedures[number];
+    }
+
+    if(CALL_STACK_SIZE == context->call_depth) {
+        (void) fprintf(stderr, "Procedure error: call stack overflow (%d calls)\n",
+                       CALL_STACK_SIZE);
+        return -1;
+    }
+
+    context->calls[context->call_depth++] = pc;
+
+    return target;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: procedure_close                                                  */
+/* Description: releases the procedure table and the call stack of a run      */
+/* Parameters: context - context of the run                                   */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void procedure_close(context_p context) {
+    free(context->procedures);
+    free(context->calls);
+    context->procedures = NULL;
+    context->calls = NULL;
+    context->call_depth = 0;
+}
+
+#if defined(USE_POSIX_IO)
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_page                                                  */
+/* Description: page of a cell of the dense tape                              */
+/* Parameters: cell - index of the cell                                       */
+/* Return: index of the page (SPARSE_PAGE_CELLS cells, rounded down)          */
+/* Note: pages of a dense tape are numbered as those of a sparse tape, so     */
+/*       a snapshot fits either tape                                          */
+/* -------------------------------------------------------------------------- */
+long checkpoint_page(long cell) {
+    return cell >= 0 ? cell / (long) SPARSE_PAGE_CELLS :
+                       -(-(cell + 1) / (long) SPARSE_PAGE_CELLS) - 1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_reset                                                 */
+/* Description: marks every page of the tape clean after a snapshot           */
+/* Parameters: context - context of the run                                   */
+/* Return: */
+/* Note: the dirty map of a dense tape covers its accessible part; pages it   */
+/*       does not cover (the tape has grown since, or no memory) are written  */
+/*       with the next snapshot as if dirty                                   */
+/* -------------------------------------------------------------------------- */
+void checkpoint_reset(context_p context) {
+    checkpoint_p checkpoint = &context->checkpoint;
+    tape_p tape = checkpoint->tape;
+    unsigned char* cells = (unsigned char*) tape->cells;
+    ptrdiff_t cell_size = (ptrdiff_t) tape->cell_size;
+    long first = 0;
+    long count = 0;
+
+    if(tape->pages) {
+        if(tape->dirty) {
+            (void) memset(tape->dirty, 0, tape->directory_size);
+        }
+        tape->last_page = NULL;
+        return;
+    }
+
+    first = checkpoint_page((long) ((tape->begin - cells) / cell_size));
+    count = checkpoint_page((long) ((tape->end - cells) / cell_size) - 1) - first + 1;
+
+    if(count != checkpoint->dirty_count) {
+        free(checkpoint->dirty);
+        checkpoint->dirty = (unsigned char*) malloc((size_t) count);
+        checkpoint->dirty_count = checkpoint->dirty ? count : 0;
+    }
+
+    if(checkpoint->dirty) {
+        (void) memset(checkpoint->dirty, 0, (size_t) count);
+    }
+    checkpoint->dirty_first = first;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_touch                                                 */
+/* Description: marks the page of the cell an instruction writes (dense tape) */
+/* Parameters: context - context of the run                                   */
+/*             instruction - instruction about to be executed                 */
+/*             cell - index of the current cell                               */
+/* Return: */
+/* Note: the pages of a sparse tape are marked as they are found (see         */
+/*       sparse_page)                                                         */
+/* -------------------------------------------------------------------------- */
+void checkpoint_touch(context_p context, const instruction_t* instruction, long cell) {
+    checkpoint_p checkpoint = &context->checkpoint;
+    long page = 0;
+
+    switch(instruction->op) {
+    case cell_add_op:
+    case cell_clear_op:
+    case cell_set_op:
+    case cell_muladd_op:
+    case data_input_op:
+        page = checkpoint_page(cell + instruction->offset) - checkpoint->dirty_first;
+        if(page >= 0 && page < checkpoint->dirty_count) {
+            checkpoint->dirty[page] = 1;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_put                                                   */
+/* Description: writes a block of a snapshot record                           */
+/* Parameters: file - snapshot file                                           */
+/*             data - block                                                   */
+/*             size - size of the block                                       */
+/*             hash - checksum of the record so far (updated)                 */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int checkpoint_put(FILE* file, const void* data, size_t size, unsigned long* hash) {
+    *hash = cache_hash(*hash, data, size);
+
+    return size && fwrite(data, 1, size, file) != size ? -1 : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_put_page                                              */
+/* Description: writes a page of the tape to a snapshot record                */
+/* Parameters: file - snapshot file                                           */
+/*             cells - first cell of the page                                 */
+/*             first - index of the first cell                                */
+/*             count - count of cells                                         */
+/*             cell_size - size of a cell in bytes                            */
+/*             skip_zero - a page of zeros is not written                     */
+/*             hash - checksum of the record so far (updated)                 */
+/* Return: 0 - written; 1 - skipped; -1 - failure                             */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int checkpoint_put_page(FILE* file, const unsigned char* cells, long first, long count,
+                        size_t cell_size, int skip_zero, unsigned long* hash) {
+    checkpoint_page_t page;
+    size_t size = (size_t) count * cell_size;
+    size_t i = 0;
+
+    if(skip_zero) {
+        for(i = 0; i < size && !cells[i]; i++) {
+        }
+        if(i == size) {
+            return 1;
+        }
+    }
+
+    page.first = first;
+    page.count = count;
+
+    return checkpoint_put(file, &page, sizeof(checkpoint_page_t), hash) ||
+           checkpoint_put(file, cells, size, hash) ? -1 : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_write                                                 */
+/* Description: writes a snapshot of the run                                  */
+/* Parameters: context - context of the run                                   */
+/*             pc - next instruction                                          */
+/*             cell - index of the current cell                               */
+/* Return: 0 - success; -1 - failure (the previous snapshot is kept)          */
+/* Note: the first record of a file holds the whole tape but its pages of     */
+/*       zeros and is written to a temporary file that is renamed; the next   */
+/*       ones hold the pages changed since and are appended and synced, so a  */
+/*       crash loses the record being written only; a new file is started     */
+/*       when the appended records outgrow the first; the output is flushed   */
+/*       first so that its size is that of the file                           */
+/* -------------------------------------------------------------------------- */
+int checkpoint_write(context_p context, index_t pc, long cell) {
+    checkpoint_p checkpoint = &context->checkpoint;
+    tape_p tape = checkpoint->tape;
+    const unsigned char* cells = (const unsigned char*) tape->cells;
+    ptrdiff_t cell_size = (ptrdiff_t) tape->cell_size;
+    char temporary[MAX_FILE_NAME_LENGTH + 24];
+    checkpoint_header_t header;
+    unsigned long hash = CACHE_HASH_BASIS;
+    FILE* file = NULL;
+    long start = 0;
+    long end = 0;
+    long entry = 0;
+    long value = 0;
+    long page = 0;
+    long first = 0;
+    long last = 0;
+    long lo = 0;
+    long hi = 0;
+    size_t i = 0;
+    int is_full = !checkpoint->file_size ||
+                  checkpoint->file_size - checkpoint->full_size > checkpoint->full_size;
+    int written = 0;
+    int result = 0;
+    int fd = -1;
+
+    output_flush(context);
+
+    (void) memset(&header, 0, sizeof(checkpoint_header_t));
+    (void) memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.version = CHECKPOINT_VERSION;
+    header.layout = ((unsigned long) sizeof(long) << 8) | (unsigned long) tape->cell_size;
+    header.program_hash = checkpoint->program_hash;
+    header.is_full = is_full ? 1 : 0;
+    header.input_count = context->input_count;
+    header.output_count = context->output_count;
+    header.pc = (long) pc;
+    header.cell = cell;
+    header.procedure_count = context->procedures ? PROCEDURE_COUNT : 0;
+    header.call_depth = (long) context->call_depth;
+
+    if(is_full) {
+        (void) sprintf(temporary, "%s.XXXXXX", checkpoint->filename);
+        fd = mkstemp(temporary);
+        if(fd >= 0) {
+            file = fdopen(fd, "wb");
+            if(!file) {
+                (void) close(fd);
+                (void) remove(temporary);
+            }
+        }
+    }
+    else {
+        file = fopen(checkpoint->filename, "r+b");
+        start = checkpoint->file_size;
+    }
+
+    if(!file) {
+        (void) fprintf(stderr, "Checkpoint error: %s not written\n", checkpoint->filename);
+        return -1;
+    }
+
+    /* The header is written again with the size and checksum at the end */
+    if(fseek(file, start, SEEK_SET) ||
+       fwrite(&header, sizeof(checkpoint_header_t), 1, file) != 1) {
+        result = -1;
+    }
+
+    for(entry = 0; !result && entry < header.procedure_count + header.call_depth; entry++) {
+        value = entry < header.procedure_count ?
+                (long) context->procedures[entry] :
+                (long) context->calls[entry - header.procedure_count];
+        result = checkpoint_put(file, &value, sizeof(long), &hash);
+    }
+
+    if(tape->pages) {
+        for(i = 0; !result && i < tape->directory_size; i++) {
+            if(tape->pages[i] && (is_full || !tape->dirty || tape->dirty[i])) {
+                written = checkpoint_put_page(file, (const unsigned char*) tape->pages[i],
+                                              (long) (tape->numbers[i] << SPARSE_PAGE_BITS),
+                                              (long) SPARSE_PAGE_CELLS, tape->cell_size,
+                                              is_full, &hash);
+                result = written < 0 ? -1 : 0;
+                header.page_count += written ? 0 : 1;
+            }
+        }
+    }
+    else {
+        lo = (long) ((tape->begin - cells) / cell_size);
+        hi = (long) ((tape->end - cells) / cell_size);
+
+        for(page = checkpoint_page(lo); !result && page <= checkpoint_page(hi - 1); page++) {
+            if(!is_full && page >= checkpoint->dirty_first &&
+               page < checkpoint->dirty_first + checkpoint->dirty_count &&
+               !checkpoint->dirty[page - checkpoint->dirty_first]) {
+                continue;
+            }
+
+            first = page * (long) SPARSE_PAGE_CELLS;
+            last = first + (long) SPARSE_PAGE_CELLS;
+            first = first < lo ? lo : first;
+            last = last > hi ? hi : last;
+
+            written = checkpoint_put_page(file, cells + first * cell_size, first, last - first,
+                                          tape->cell_size, is_full, &hash);
+            result = written < 0 ? -1 : 0;
+            header.page_count += written ? 0 : 1;
+        }
+    }
+
+    if(!result) {
+        end = ftell(file);
+        header.size = (unsigned long) (end - start) - sizeof(checkpoint_header_t);
+        header.checksum = cache_hash(hash, &header, sizeof(checkpoint_header_t));
+
+        if(end < 0 || fseek(file, start, SEEK_SET) ||
+           fwrite(&header, sizeof(checkpoint_header_t), 1, file) != 1 ||
+           fflush(file) || fsync(fileno(file))) {
+            result = -1;
+        }
+    }
+
+    if(fclose(file)) {
+        result = -1;
+    }
+
+    if(is_full && (result || rename(temporary, checkpoint->filename))) {
+        (void) remove(temporary);
+        result = -1;
+    }
+
+    if(result) {
+        (void) fprintf(stderr, "Checkpoint error: %s not written\n", checkpoint->filename);
+        return -1;
+    }
+
+    checkpoint->file_size = end;
+    if(is_full) {
+        checkpoint->full_size = end;
+    }
+    checkpoint_reset(context);
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_tick                                                  */
+/* Description: writes a snapshot when it is due (the countdown is over)      */
+/* Parameters: context - context of the run                                   */
+/*             pc - next instruction                                          */
+/*             cell - index of the current cell                               */
+/* Return: */
+/* Note: with an interval in seconds the clock is read every                  */
+/*       CHECKPOINT_CLOCK_STEPS operations; a failed snapshot is reported and */
+/*       the run goes on, its pages are written with the next one             */
+/* -------------------------------------------------------------------------- */
+void checkpoint_tick(context_p context, index_t pc, long cell) {
+    checkpoint_p checkpoint = &context->checkpoint;
+
+    if(!context->options->checkpoint_seconds) {
+        checkpoint->countdown = checkpoint->interval;
+        (void) checkpoint_write(context, pc, cell);
+        return;
+    }
+
+    checkpoint->countdown = CHECKPOINT_CLOCK_STEPS;
+    if(time(NULL) >= checkpoint->due) {
+        (void) checkpoint_write(context, pc, cell);
+        checkpoint->due = time(NULL) + checkpoint->interval;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_apply                                                 */
+/* Description: restores the state saved by a snapshot record                 */
+/* Parameters: context - context of the run                                   */
+/*             program - compiled program                                     */
+/*             header - header of the record                                  */
+/*             payload - rest of the record (header->size bytes, checked)     */
+/* Return: 0 - success; -1 - the record does not fit the program or the tape  */
+/* Note: a full record clears the tape first                                  */
+/* -------------------------------------------------------------------------- */
+int checkpoint_apply(context_p context, const program_t* program,
+                     const checkpoint_header_t* header, const unsigned char* payload) {
+    checkpoint_p checkpoint = &context->checkpoint;
+    tape_p tape = checkpoint->tape;
+    unsigned char* cells = (unsigned char*) tape->cells;
+    ptrdiff_t cell_size = (ptrdiff_t) tape->cell_size;
+    const unsigned char* position = payload;
+    const unsigned char* end = payload + header->size;
+    checkpoint_page_t page;
+    unsigned char* target = NULL;
+    long value = 0;
+    long lo = LONG_MIN;
+    long hi = LONG_MAX;
+    long i = 0;
+
+    /* Cells a dense tape can hold: the guarded range grows on faults */
+    if(!tape->pages) {
+        lo = (long) (((tape->reserve ? tape->reserve : tape->begin) - cells) / cell_size);
+        hi = (long) (((tape->reserve ? tape->reserve + tape->reserve_size : tape->end) - cells) /
+                     cell_size);
+    }
+
+    if(header->pc < 0 || header->pc >= (long) program->size ||
+       header->cell < lo || header->cell >= hi ||
+       header->procedure_count != (context->procedures ? PROCEDURE_COUNT : 0) ||
+       header->call_depth < 0 || header->call_depth > (context->procedures ? CALL_STACK_SIZE : 0) ||
+       (unsigned long) (header->procedure_count + header->call_depth) >
+       header->size / sizeof(long)) {
+        return -1;
+    }
+
+    for(i = 0; i < header->procedure_count + header->call_depth; i++) {
+        (void) memcpy(&value, position, sizeof(long));
+        position += sizeof(long);
+
+        if(value < (i < header->procedure_count ? -1 : 0) || value >= (long) program->size) {
+            return -1;
+        }
+
+        if(i < header->procedure_count) {
+            context->procedures[i] = (index_t) value;
+        }
+        else {
+            context->calls[i - header->procedure_count] = (index_t) value;
+        }
+    }
+    context->call_depth = (index_t) header->call_depth;
+
+    if(header->is_full) {
+        clear_tape(tape);
+    }
+
+    for(i = 0; i < header->page_count; i++) {
+        if((size_t) (end - position) < sizeof(checkpoint_page_t)) {
+            return -1;
+        }
+        (void) memcpy(&page, position, sizeof(checkpoint_page_t));
+        position += sizeof(checkpoint_page_t);
+
+        if(page.count < 1 || page.count > (long) SPARSE_PAGE_CELLS ||
+           (size_t) (end - position) / tape->cell_size < (size_t) page.count) {
+            return -1;
+        }
+
+        if(tape->pages) {
+            if(((unsigned long) page.first & (SPARSE_PAGE_CELLS - 1)) + (unsigned long) page.count >
+               SPARSE_PAGE_CELLS) {
+                return -1;
+            }
+            target = (unsigned char*) sparse_page(tape,
+                                                  (unsigned long) page.first >> SPARSE_PAGE_BITS);
+            if(!target) {
+                return -1;
+            }
+            target += ((unsigned long) page.first & (SPARSE_PAGE_CELLS - 1)) * tape->cell_size;
+        }
+        else {
+            if(page.first < lo || page.first > hi - page.count) {
+                return -1;
+            }
+            target = cells + page.first * cell_size;
+        }
+
+        (void) memcpy(target, position, (size_t) page.count * tape->cell_size);
+        position += (size_t) page.count * tape->cell_size;
+    }
+
+    checkpoint->pc = (index_t) header->pc;
+    checkpoint->cell = header->cell;
+    context->input_count = header->input_count;
+    context->output_count = header->output_count;
+
+    return position == end ? 0 : -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_load                                                  */
+/* Description: restores the run from its snapshot file                       */
+/* Parameters: context - context of the run (I/O and procedures open)         */
+/*             program - compiled program                                     */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the records are applied in order up to the first incomplete or       */
+/*       damaged one, which is cut off so that the next snapshots follow the  */
+/*       last good one; the input is read again from its start and the bytes  */
+/*       consumed before the snapshot are skipped; an output file is cut to   */
+/*       the size it had at the snapshot                                      */
+/* -------------------------------------------------------------------------- */
+int checkpoint_load(context_p context, const program_t* program) {
+    checkpoint_p checkpoint = &context->checkpoint;
+    checkpoint_header_t header;
+    unsigned char* payload = NULL;
+    unsigned char* buffer = NULL;
+    unsigned long checksum = 0;
+    unsigned long layout = ((unsigned long) sizeof(long) << 8) |
+                           (unsigned long) checkpoint->tape->cell_size;
+    unsigned long skip = 0;
+    size_t step = 0;
+    FILE* file = NULL;
+    long size = 0;
+    long start = 0;
+    int result = 0;
+
+    file = fopen(checkpoint->filename, "rb");
+    if(!file) {
+        perror("File not open");
+        return -1;
+    }
+
+    if(fseek(file, 0, SEEK_END) || (size = ftell(file)) < 0 || fseek(file, 0, SEEK_SET)) {
+        perror("Checkpoint error");
+        (void) fclose(file);
+        return -1;
+    }
+
+    while(fread(&header, sizeof(checkpoint_header_t), 1, file) == 1) {
+        if(memcmp(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic)) ||
+           header.version != CHECKPOINT_VERSION || header.layout != layout ||
+           header.size > (unsigned long) (size - start) - sizeof(checkpoint_header_t) ||
+           (!start && !header.is_full)) {
+            break;
+        }
+
+        if(header.program_hash != checkpoint->program_hash) {
+            (void) fprintf(stderr, "Checkpoint error: %s is a snapshot of another program\n",
+                           checkpoint->filename);
+            result = -1;
+            break;
+        }
+
+        buffer = (unsigned char*) realloc(payload, header.size ? (size_t) header.size : 1);
+        if(!buffer) {
+            perror("Memory error");
+            result = -1;
+            break;
+        }
+        payload = buffer;
+
+        if(fread(payload, 1, (size_t) header.size, file) != (size_t) header.size) {
+            break;
+        }
+
+        checksum = header.checksum;
+        header.checksum = 0;
+        if(cache_hash(cache_hash(CACHE_HASH_BASIS, payload, (size_t) header.size),
+                      &header, sizeof(checkpoint_header_t)) != checksum) {
+            break;
+        }
+
+        if(checkpoint_apply(context, program, &header, payload)) {
+            (void) fprintf(stderr, "Checkpoint error: %s does not fit the program\n",
+                           checkpoint->filename);
+            result = -1;
+            break;
+        }
+
+        start += (long) (sizeof(checkpoint_header_t) + header.size);
+        if(header.is_full) {
+            checkpoint->full_size = start;
+        }
+    }
+
+    free(payload);
+    (void) fclose(file);
+
+    if(!result && !start) {
+        (void) fprintf(stderr, "Checkpoint error: no snapshot in %s\n", checkpoint->filename);
+        result = -1;
+    }
+
+    if(result) {
+        return -1;
+    }
+
+    /* A damaged record at the end would hide the next ones */
+    if(start < size && truncate(checkpoint->filename, (off_t) start)) {
+        perror("Checkpoint error");
+        return -1;
+    }
+    checkpoint->file_size = start;
+
+#if defined(USE_WRITEV)
+    if(context->output.is_open &&
+       (ftruncate(context->output.fd, (off_t) context->output_count) ||
+        lseek(context->output.fd, 0, SEEK_END) < 0)) {
+        perror("Output error");
+        return -1;
+    }
+#endif /* defined(USE_WRITEV) */
+
+    for(skip = context->input_count; skip; skip -= (unsigned long) step) {
+        if(context->input.position >= context->input.size && input_fill(context)) {
+            (void) fprintf(stderr, "Checkpoint error: the input ends before the snapshot\n");
+            return -1;
+        }
+
+        step = context->input.size - context->input.position;
+        if(step > skip) {
+            step = (size_t) skip;
+        }
+        context->input.position += step;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_open                                                  */
+/* Description: prepares the snapshots of a run (--checkpoint-every) and      */
+/*              resumes it from a snapshot file (--resume)                    */
+/* Parameters: context - context of the run (I/O and procedures open)         */
+/*             program - compiled program                                     */
+/*             tape - tape                                                    */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the snapshots go to the file the run resumed from, otherwise to the  */
+/*       source file name with CHECKPOINT_SUFFIX; the records hold a hash of  */
+/*       the compiled program, so a snapshot of another program or of other   */
+/*       options of the language is refused                                   */
+/* -------------------------------------------------------------------------- */
+int checkpoint_open(context_p context, const program_t* program, tape_p tape) {
+    const program_options_t* run_options = context->options;
+    checkpoint_p checkpoint = &context->checkpoint;
+
+    if(!run_options->checkpoint_interval && !run_options->resume_filename[0]) {
+        return 0;
+    }
+
+    checkpoint->tape = tape;
+    checkpoint->program_hash =
+        cache_hash(cache_hash(CACHE_HASH_BASIS, program->code,
+                              (size_t) program->size * sizeof(instruction_t)),
+                   program->data, (size_t) program->data_size);
+
+    if(run_options->resume_filename[0]) {
+        (void) strcpy(checkpoint->filename, run_options->resume_filename);
+
+        if(checkpoint_load(context, program)) {
+            checkpoint_close(context);
+            return -1;
+        }
+    }
+    else {
+        (void) sprintf(checkpoint->filename, "%s%s", run_options->source_filename,
+                       CHECKPOINT_SUFFIX);
+    }
+
+    checkpoint->interval = run_options->checkpoint_interval;
+    if(checkpoint->interval) {
+        checkpoint->countdown = run_options->checkpoint_seconds ? CHECKPOINT_CLOCK_STEPS :
+                                                                  checkpoint->interval;
+        checkpoint->due = time(NULL) + checkpoint->interval;
+
+        /* No memory for the flags: every page is written */
+        if(tape->pages && !tape->dirty) {
+            tape->dirty = (unsigned char*) calloc(tape->directory_size, 1);
+        }
+        checkpoint_reset(context);
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: checkpoint_close                                                 */
+/* Description: releases the dirty page flags of a run                        */
+/* Parameters: context - context of the run                                   */
+/* Return: */
+/* Note: the snapshot file is kept                                            */
+/* -------------------------------------------------------------------------- */
+void checkpoint_close(context_p context) {
+    checkpoint_p checkpoint = &context->checkpoint;
+
+    if(checkpoint->tape) {
+        free(checkpoint->tape->dirty);
+        checkpoint->tape->dirty = NULL;
+    }
+    free(checkpoint->dirty);
+
+    (void) memset(checkpoint, 0, sizeof(checkpoint_t));
+}
+#endif /* defined(USE_POSIX_IO) */
+
+/* -------------------------------------------------------------------------- */
+/* Function: limit_open                                                       */
+/* Description: sets the step budget of a run and starts its timer            */
+/* Parameters: context - context of the run                                   */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: without --max-steps the budget is LONG_MAX, so the engines charge    */
+/*       steps whenever a limit is set; the timer raises SIGALRM once, which  */
+/*       interrupts a blocked read (one run with a time limit at a time)      */
+/* -------------------------------------------------------------------------- */
+int limit_open(context_p context) {
+    const program_options_t* run_options = context->options;
+#if defined(USE_POSIX_IO)
+    struct sigaction action;
+    struct itimerval timer;
+#endif /* defined(USE_POSIX_IO) */
+
+    context->limit = no_limit;
+    context->steps = 0;
+
+    if(!run_options->max_steps && !run_options->max_time && !run_options->max_output) {
+        return 0;
+    }
+    context->steps = run_options->max_steps ? run_options->max_steps : LONG_MAX;
+
+#if defined(USE_POSIX_IO)
+    if(run_options->max_time) {
+        (void) memset(&action, 0, sizeof(action));
+        action.sa_handler = limit_alarm;
+        (void) sigemptyset(&action.sa_mask);
+
+        (void) memset(&timer, 0, sizeof(timer));
+        timer.it_value.tv_sec = (time_t) (run_options->max_time / 1000);
+        timer.it_value.tv_usec = (suseconds_t) (run_options->max_time % 1000 * 1000);
+
+        limit_context = context;
+        if(sigaction(SIGALRM, &action, &limit_old_alarm)) {
+            perror("Signal error");
+            limit_context = NULL;
+            return -1;
+        }
+        if(setitimer(ITIMER_REAL, &timer, NULL)) {
+            perror("Signal error");
+            (void) sigaction(SIGALRM, &limit_old_alarm, NULL);
+            limit_context = NULL;
+            return -1;
+        }
+    }
+#endif /* defined(USE_POSIX_IO) */
+
+    return 0;
+}
+
+#if defined(USE_POSIX_IO)
+/* -------------------------------------------------------------------------- */
+/* Function: limit_alarm                                                      */
+/* Description: marks the run with a time limit as out of time                */
+/* Parameters: sig - SIGALRM                                                  */
+/* Return: */
+/* Note: the engines stop at the next back-edge                               */
+/* -------------------------------------------------------------------------- */
+void limit_alarm(int sig) {
+    context_p context = limit_context;
+
+    if(context && !context->limit) {
+        context->limit = time_limit;
+    }
+    (void) sig;
+}
+#endif /* defined(USE_POSIX_IO) */
+
+/* -------------------------------------------------------------------------- */
+/* Function: limit_reached                                                    */
+/* Description: stops a run at a limit                                        */
+/* Parameters: context - context of the run                                   */
+/*             steps - step budget left                                       */
+/* Return: -1 (returned by the engines)                                       */
+/* Note: called at a back-edge when the budget is spent or another limit has  */
+/*       been reached since the previous one, and when a limit cut a read     */
+/*       short (see data_input)                                               */
+/* -------------------------------------------------------------------------- */
+int limit_reached(context_p context, long steps) {
+    context->steps = steps;
+    if(!context->limit) {
+        context->limit = step_limit;
+    }
+
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: limit_close                                                      */
+/* Description: stops the timer of a run and reports the limit it reached     */
+/* Parameters: context - context of the run                                   */
+/* Return: */
+/* Note: the pending output is written first, so that output beyond the       */
+/*       limit is never written; the steps are those charged (see the         */
+/*       engines), about the count of operations executed                     */
+/* -------------------------------------------------------------------------- */
+void limit_close(context_p context) {
+    static const char* const names[] = { "", "step", "time", "output" };
+    const program_options_t* run_options = context->options;
+#if defined(USE_POSIX_IO)
+    struct itimerval timer;
+#endif /* defined(USE_POSIX_IO) */
+
+    if(!run_options->max_steps && !run_options->max_time && !run_options->max_output) {
+        return;
+    }
+
+    output_flush(context);
+
+#if defined(USE_POSIX_IO)
+    if(run_options->max_time && limit_context == context) {
+        (void) memset(&timer, 0, sizeof(timer));
+        (void) setitimer(ITIMER_REAL, &timer, NULL);
+        (void) sigaction(SIGALRM, &limit_old_alarm, NULL);
+        limit_context = NULL;
+    }
+#endif /* defined(USE_POSIX_IO) */
+
+    if(context->limit) {
+        (void) fprintf(stderr, "Limit error: %s limit reached after about %ld steps and %lu "
+                       "output bytes\n", names[context->limit],
+                       (run_options->max_steps ? run_options->max_steps : LONG_MAX) -
+                       context->steps, context->output_count);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: print_trace_legend                                               */
+/* Description: prints the legend of the trace lines                          */
+/* Parameters: */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void print_trace_legend(void) {
+    (void) printf("* - command\n");
+    (void) printf("symbol - current readable symbol (HEX)\n");
+    (void) printf("count - folded repeat count of the symbol\n");
+    (void) printf("ccn - number of the cell used (HEX)\n");
+    (void) printf("ccv - value of the cell used (HEX/OCT/DEC)\n");
+    (void) printf("----------------------------------------\n");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: print_trace_event                                                */
+/* Description: prints a trace event in the human-readable (verbose) format   */
+/* Parameters: event - trace event                                            */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void print_trace_event(const trace_event_t* event) {
+    static const char opcode_symbols[] = OPCODE_SYMBOLS;
+    code_t symbol = '?';
+
+    if(event->op < sizeof(opcode_symbols) - 1) {
+        symbol = opcode_symbols[event->op];
+    }
+    if(event->arg < 0) {
+        symbol = (cell_add_op == event->op) ? '-' : '<';
+    }
+
+    (void) printf("* \'%c\' symbol=0x%02X; count=%ld; ccn=%ld; ccv=0x%04lX; ccv=0%05lo; ccv=%li;\n",
+                  symbol,
+                  (int) symbol,
+                  labs(event->arg),
+                  event->cell,
+                  (unsigned long int) event->value,
+                  (unsigned long int) event->value,
+                  event->value);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: trace_open                                                       */
+/* Description: allocates the trace ring buffer                               */
+/* Parameters: context - context of the run                                   */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the buffer holds the last trace_events recorded events; one in       */
+/*       trace_sample operations is recorded; SIGUSR1 dumps the trace         */
+/* -------------------------------------------------------------------------- */
+int trace_open(context_p context) {
+    trace_buffer_p trace = &context->trace;
+
+    (void) memset(trace, 0, sizeof(trace_buffer_t));
+
+    trace->capacity = context->options->trace_events ? context->options->trace_events : 1;
+    trace->sample = context->options->trace_sample ? context->options->trace_sample : 1;
+    trace->countdown = 1;
+
+    trace->events = (trace_event_p) malloc((size_t) trace->capacity * sizeof(trace_event_t));
+    if(!trace->events) {
+        perror("Memory error");
+        return -1;
+    }
+
+#if defined(USE_POSIX_IO)
+    (void) signal(SIGUSR1, signal_handler);
+    (void) signal(SIGINT, signal_handler);
+    (void) signal(SIGTERM, signal_handler);
+    (void) signal(SIGHUP, signal_handler);
+#endif /* defined(USE_POSIX_IO) */
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: trace_offset                                                     */
+/* Description: gives the cell traced for an instruction                      */
+/* Parameters: instruction - instruction                                      */
+/* Return: cell used by the instruction, relative to the current cell         */
+/* Note: the offset of the cell ops and I/O (see optimize_offsets); 0 for the */
+/*       others, whose offset is not a cell or which use the current cell     */
+/* -------------------------------------------------------------------------- */
+long trace_offset(const instruction_t* instruction) {
+    switch(instruction->op) {
+    case cell_add_op:
+    case cell_clear_op:
+    case cell_set_op:
+    case cell_muladd_op:
+    case data_output_op:
+    case data_input_op:
+        return instruction->offset;
+    default:
+        return 0;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: trace_record                                                     */
+/* Description: records an executed instruction                               */
+/* Parameters: context - context of the run (trace ring buffer)              */
+/*             pc - index of the instruction                                  */
+/*             instruction - instruction                                      */
+/*             cell - index of the cell used (see trace_offset)               */
+/*             value - value of that cell                                     */
+/* Return: */
+/* Note: in verbose mode the event is also printed                            */
+/* -------------------------------------------------------------------------- */
+void trace_record(context_p context, index_t pc, const instruction_t* instruction,
+                  long cell, long value) {
+    trace_buffer_p trace = &context->trace;
+    trace_event_t event;
+
+    (void) memset(&event, 0, sizeof(trace_event_t));
+    event.cell = cell;
+    event.value = value;
+    event.arg = instruction->arg;
+    event.pc = pc;
+    event.op = (unsigned char) instruction->op;
+
+    if(context->options->verbose) {
+        print_trace_event(&event);
+    }
+
+    if(trace->events && !--trace->countdown) {
+        trace->countdown = trace->sample;
+        trace->events[trace->recorded++ % trace->capacity] = event;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: trace_dump                                                       */
+/* Description: writes the trace to a file                                    */
+/* Parameters: trace - trace ring buffer                                      */
+/*             filename - trace file name                                     */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: async-signal-safe with POSIX I/O; events are written oldest first    */
+/* -------------------------------------------------------------------------- */
+int trace_dump(const trace_buffer_t* trace, const char* filename) {
+    trace_header_t header;
+    unsigned long first = 0;
+    unsigned long count = trace->recorded < trace->capacity ? trace->recorded : trace->capacity;
+    int result = 0;
+#if defined(USE_POSIX_IO)
+    const char* chunks[3];
+    size_t sizes[3];
+    ssize_t written = 0;
+    int fd = -1;
+    int i = 0;
+#else
+    FILE* file = NULL;
+#endif /* defined(USE_POSIX_IO) */
+
+    (void) memset(&header, 0, sizeof(trace_header_t));
+    (void) memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+    header.version = TRACE_VERSION;
+    header.event_size = sizeof(trace_event_t);
+    header.count = count;
+    header.recorded = trace->recorded;
+    header.sample = trace->sample;
+
+    first = trace->recorded > trace->capacity ? trace->recorded % trace->capacity : 0;
+
+#if defined(USE_POSIX_IO)
+    chunks[0] = (const char*) &header;
+    sizes[0] = sizeof(trace_header_t);
+    chunks[1] = (const char*) (trace->events + first);
+    sizes[1] = (size_t) (count - first) * sizeof(trace_event_t);
+    chunks[2] = (const char*) trace->events;
+    sizes[2] = (size_t) first * sizeof(trace_event_t);
+
+    fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0) {
+        return -1;
+    }
+
+    for(i = 0; i < 3 && !result; i++) {
+        while(sizes[i]) {
+            written = write(fd, chunks[i], sizes[i]);
+            if(written < 0) {
+                if(EINTR == errno) {
+                    continue;
+                }
+                result = -1;
+                break;
+            }
+            chunks[i] += written;
+            sizes[i] -= (size_t) written;
+        }
+    }
+
+    if(close(fd)) {
+        result = -1;
+    }
+#else
+    if((file = fopen(filename, "wb")) == NULL) {
+        return -1;
+    }
+
+    if(fwrite(&header, sizeof(trace_header_t), 1, file) != 1 ||
+       fwrite(trace->events + first, sizeof(trace_event_t), (size_t) (count - first), file) != (size_t) (count - first) ||
+       fwrite(trace->events, sizeof(trace_event_t), (size_t) first, file) != (size_t) first) {
+        result = -1;
+    }
+
+    if(fclose(file)) {
+        result = -1;
+    }
+#endif /* defined(USE_POSIX_IO) */
+
+    return result;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: trace_close                                                      */
+/* Description: dumps and releases the trace                                  */
+/* Parameters: context - context of the run                                   */
+/* Return: */
+/* Note: safe to call more than once                                          */
+/* -------------------------------------------------------------------------- */
+void trace_close(context_p context) {
+    if(context->trace.events) {
+        if(trace_dump(&context->trace, context->options->trace_filename)) {
+            perror("Trace error");
+        }
+        free(context->trace.events);
+    }
+
+    (void) memset(&context->trace, 0, sizeof(trace_buffer_t));
+}
+
+#if !defined(BFPLUS_LIBRARY)
+/* -------------------------------------------------------------------------- */
+/* Function: decode_trace                                                     */
+/* Description: prints a trace file in the human-readable (verbose) format    */
+/* Parameters: filename - trace file name                                     */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int decode_trace(const char* filename) {
+    trace_header_t header;
+    trace_event_t event;
+    FILE* file = NULL;
+    unsigned long i = 0;
+
+    if((file = fopen(filename, "rb")) == NULL) {
+        perror("File not open");
+        return -1;
+    }
+
+    if(fread(&header, sizeof(trace_header_t), 1, file) != 1 ||
+       memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) ||
+       TRACE_VERSION != header.version ||
+       sizeof(trace_event_t) != header.event_size) {
+        (void) fprintf(stderr, "Trace error: %s is not a trace file of this version\n", filename);
+        fclose(file);
+        return -1;
+    }
+
+    (void) printf("Trace: %lu of %lu recorded events (1 in %lu operations)\n",
+                  header.count, header.recorded, header.sample);
+    print_trace_legend();
+
+    for(i = 0; i < header.count; i++) {
+        if(fread(&event, sizeof(trace_event_t), 1, file) != 1) {
+            (void) fprintf(stderr, "Trace error: %s is truncated\n", filename);
+            fclose(file);
+            return -1;
+        }
+        print_trace_event(&event);
+    }
+
+    fclose(file);
+    return 0;
+}
+
+#endif /* !defined(BFPLUS_LIBRARY) */
+
+/* -------------------------------------------------------------------------- */
+/* Function: profile_open                                                     */
+/* Description: allocates the execution counters of the instructions         */
+/* Parameters: context - context of the run                                   */
+/*             program - compiled program                                     */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int profile_open(context_p context, const program_t* program) {
+    context->profile_counts = (unsigned long*) calloc((size_t) program->size, sizeof(unsigned long));
+    if(!context->profile_counts) {
+        perror("Memory error");
+        return -1;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: compare_loop_profiles                                            */
+/* Description: orders loops by their own operations (descending)             */
+/* Parameters: first - loop_profile_t                                         */
+/*             second - loop_profile_t                                        */
+/* Return: <0, 0, >0 (qsort)                                                  */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int compare_loop_profiles(const void* first, const void* second) {
+    const loop_profile_t* a = (const loop_profile_t*) first;
+    const loop_profile_t* b = (const loop_profile_t*) second;
+
+    if(a->self != b->self) {
+        return a->self < b->self ? 1 : -1;
+    }
+
+    return a->begin < b->begin ? -1 : (a->begin > b->begin);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: compare_profile_counts                                           */
+/* Description: orders instructions by execution count (descending)           */
+/* Parameters: first - instruction_profile_t                                  */
+/*             second - instruction_profile_t                                 */
+/* Return: <0, 0, >0 (qsort)                                                  */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int compare_profile_counts(const void* first, const void* second) {
+    const instruction_profile_t* a = (const instruction_profile_t*) first;
+    const instruction_profile_t* b = (const instruction_profile_t*) second;
+
+    if(a->count != b->count) {
+        return a->count < b->count ? 1 : -1;
+    }
+
+    return a->pc < b->pc ? -1 : (a->pc > b->pc);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: print_profile                                                    */
+/* Description: prints the hot loops and instructions to the standard error   */
+/* Parameters: context - context of the run (execution counters)             */
+/*             program - compiled program (with source positions)             */
+/* Return: */
+/* Note: an operation belongs to the innermost loop around it; loops are      */
+/*       sorted by their own operations with the cumulative share; loops      */
+/*       rewritten by the optimizer are single operations                     */
+/* -------------------------------------------------------------------------- */
+void print_profile(const context_t* context, const program_t* program) {
+    static const char opcode_symbols[] = OPCODE_SYMBOLS;
+    const unsigned long* profile_counts = context->profile_counts;
+    loop_profile_p loops = NULL;
+    index_p stack = NULL;
+    instruction_profile_p order = NULL;
+    index_t loop_count = 0;
+    index_t stack_index = -1;
+    index_t pc = 0;
+    index_t i = 0;
+    unsigned long total = 0;
+    unsigned long cumulative = 0;
+    loop_profile_p loop = NULL;
+
+    loops = (loop_profile_p) calloc((size_t) program->size, sizeof(loop_profile_t));
+    stack = (index_p) malloc((size_t) program->size * sizeof(index_t));
+    order = (instruction_profile_p) malloc((size_t) program->size * sizeof(instruction_profile_t));
+    if(!loops || !stack || !order) {
+        perror("Memory error");
+        goto done;
+    }
+
+    for(pc = 0; pc < program->size; pc++) {
+        total += profile_counts[pc];
+        order[pc].pc = pc;
+        order[pc].count = profile_counts[pc];
+
+        if(loop_begin_op == program->code[pc].op) {
+            loops[loop_count].begin = pc;
+            stack[++stack_index] = loop_count++;
+        }
+
+        if(stack_index >= 0) {
+            loops[stack[stack_index]].self += profile_counts[pc];
+        }
+
+        if(loop_end_op == program->code[pc].op) {
+            /* Every iteration ends at the closing bracket */
+            loop = &loops[stack[stack_index--]];
+            loop->iterations = profile_counts[pc];
+            loop->total += loop->self;
+            if(stack_index >= 0) {
+                loops[stack[stack_index]].total += loop->total;
+            }
+        }
+    }
+
+    qsort(loops, (size_t) loop_count, sizeof(loop_profile_t), compare_loop_profiles);
+    qsort(order, (size_t) program->size, sizeof(instruction_profile_t), compare_profile_counts);
+
+    (void) fprintf(stderr, "Profile: %lu operations, %d instructions, %d loops\n",
+                   total, (int) program->size, (int) loop_count);
+    if(!total) {
+        goto done;
+    }
+
+    (void) fprintf(stderr, "Hot loops:\n");
+    (void) fprintf(stderr, "%12s %20s %8s %8s %8s\n",
+                   "line:column", "iterations", "self", "cumul", "total");
+    for(i = 0; i < loop_count && i < PROFILE_REPORT_SIZE && loops[i].self; i++) {
+        cumulative += loops[i].self;
+        (void) fprintf(stderr, "%7ld:%-4ld %20lu %7.2f%% %7.2f%% %7.2f%%\n",
+                       program->positions[loops[i].begin].line,
+                       program->positions[loops[i].begin].column,
+                       loops[i].iterations,
+                       100.0 * (double) loops[i].self / (double) total,
+                       100.0 * (double) cumulative / (double) total,
+                       100.0 * (double) loops[i].total / (double) total);
+    }
+
+    (void) fprintf(stderr, "Hot instructions:\n");
+    (void) fprintf(stderr, "%12s %20s %8s %s\n",
+                   "line:column", "count", "share", "operation");
+    for(i = 0; i < program->size && i < PROFILE_REPORT_SIZE && order[i].count; i++) {
+        pc = order[i].pc;
+        (void) fprintf(stderr, "%7ld:%-4ld %20lu %7.2f%% '%c' %ld\n",
+                       program->positions[pc].line,
+                       program->positions[pc].column,
+                       profile_counts[pc],
+                       100.0 * (double) profile_counts[pc] / (double) total,
+                       opcode_symbols[program->code[pc].op],
+                       program->code[pc].arg);
+    }
+done:
+    free(loops);
+    free(stack);
+    free(order);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: profile_close                                                    */
+/* Description: releases the execution counters                               */
+/* Parameters: context - context of the run                                   */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void profile_close(context_p context) {
+    if(context->profile_counts) {
+        free(context->profile_counts);
+        context->profile_counts = NULL;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: jit_emit                                                         */
+/* Description: appends machine code bytes to the buffer                      */
+/* Parameters: buffer - native code buffer                                    */
+/*             bytes - machine code                                           */
+/*             count - number of bytes                                        */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int jit_emit(jit_buffer_p buffer, const unsigned char* bytes, size_t count) {
+    unsigned char* new_code = NULL;
+    size_t new_capacity = 0;
+
+    if(buffer->size + count > buffer->capacity) {
+        new_capacity = buffer->capacity ? buffer->capacity * 2 : JIT_INITIAL_CODE_SIZE;
+        new_code = (unsigned char*) realloc(buffer->code, new_capacity);
+        if(!new_code) {
+            perror("Memory error");
+            return -1;
+        }
+        buffer->code = new_code;
+        buffer->capacity = new_capacity;
+    }
+
+    (void) memcpy(buffer->code + buffer->size, bytes, count);
+    buffer->size += count;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: jit_data_write                                                   */
+/* Description: constant output callback of the native code                   */
+/* Parameters: callbacks - callback table (holds the program and the context) */
+/*             pc - index of the data_write_op                                */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void jit_data_write(const jit_callbacks_t* callbacks, long pc) {
+    data_write(callbacks->context, callbacks->program, &callbacks->program->code[pc]);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: jit_tape_error                                                   */
+/* Description: failed check callback of the native code                      */
+/* Parameters: callbacks - callback table (holds the program and the context) */
+/*             pc - index of the check                                        */
+/*             cell - current cell                                            */
+/* Return: */
+/* Note: the native code returns after it                                     */
+/* -------------------------------------------------------------------------- */
+void jit_tape_error(const jit_callbacks_t* callbacks, long pc, long cell) {
+    tape_error(cell, &callbacks->program->code[pc]);
+    callbacks->context->jit_result = -1;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: jit_limit_reached                                                */
+/* Description: limit callback of the native code                             */
+/* Parameters: callbacks - callback table (holds the context and the budget)  */
+/*             pc - index of the back-edge                                    */
+/* Return: */
+/* Note: the native code returns after it                                     */
+/* -------------------------------------------------------------------------- */
+void jit_limit_reached(const jit_callbacks_t* callbacks, long pc) {
+    (void) limit_reached(callbacks->context, callbacks->steps);
+    callbacks->context->jit_result = -1;
+    (void) pc;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: jit_store_value                                                  */
+/* Description: stores a little-endian immediate                              */
+/* Parameters: bytes - destination                                            */
+/*             value - immediate value                                        */
+/*             count - size of the immediate in bytes (1, 2, 4 or 8)          */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void jit_store_value(unsigned char* bytes, long value, size_t count) {
+    unsigned long bits = (unsigned long) value;
+    size_t i = 0;
+
+    for(i = 0; i < count; i++) {
+        bytes[i] = (unsigned char) (bits & 0xFF);
+        bits >>= 8;
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: jit_emit_value                                                   */
+/* Description: appends a little-endian immediate to the buffer               */
+/* Parameters: buffer - native code buffer                                    */
+/*             value - immediate value                                        */
+/*             count - size of the immediate in bytes (1, 2, 4 or 8)          */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int jit_emit_value(jit_buffer_p buffer, long value, size_t count) {
+    unsigned char bytes[sizeof(unsigned long)];
+
+    jit_store_value(bytes, value, count);
+
+    return jit_emit(buffer, bytes, count);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: jit_emit_cell                                                    */
+/* Description: appends an instruction operating on a cell                    */
+/* Parameters: buffer - native code buffer                                    */
+/*             cell_size - size of a cell in bytes (1, 2, 4 or 8)             */
+/*             opcode - { byte opcode, word/dword/qword opcode, ModR/M }      */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the operand size prefix is chosen by the cell size                   */
+/* -------------------------------------------------------------------------- */
+int jit_emit_cell(jit_buffer_p buffer, size_t cell_size, const unsigned char* opcode) {
+    unsigned char bytes[3];
+    size_t count = 0;
+
+    if(2 == cell_size) {
+        bytes[count++] = 0x66;  /* operand size prefix */
+    }
+    else if(8 == cell_size) {
+        bytes[count++] = 0x48;  /* REX.W               */
+    }
+
+    bytes[count++] = 1 == cell_size ? opcode[0] : opcode[1];
+    bytes[count++] = opcode[2];
+
+    return jit_emit(buffer, bytes, count);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: jit_compile                                                      */
+/* Description: translates the compiled program into x86-64 machine code      */
+/* Parameters: program - compiled program                                     */
+/*             cell_size - size of a cell in bytes (1, 2, 4 or 8)             */
+/*             limits - charge the back-edges and the LOOP_GUARD loops to the */
+/*                      step budget (see the engines), check the limit of     */
+/*                      the context and return after a read cut short         */
+/*             buffer - native code buffer (out)                              */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: rbx holds the current cell, r12 the jit_callbacks_t table;           */
+/*       the code is position independent; cells are accessed with their     */
+/*       own operand size, so narrow cells wrap around natively               */
+/* -------------------------------------------------------------------------- */
+int jit_compile(const program_t* program, size_t cell_size, int limits, jit_buffer_p buffer) {
+#define JIT_IS_INT32(value) ((value) >= -2147483647L - 1 && (value) <= 2147483647L)
+    static const unsigned char prologue[] = {
+        0x53,                   /* push rbx     */
+        0x41, 0x54,             /* push r12     */
+        0x55,                   /* push rbp     */
+        0x48, 0x89, 0xFB,       /* mov rbx, rdi */
+        0x49, 0x89, 0xF4,       /* mov r12, rsi */
+        0x48, 0x89, 0xFD        /* mov rbp, rdi */
+    };
+    static const unsigned char epilogue[] = {
+        0x5D,                   /* pop rbp      */
+        0x41, 0x5C,             /* pop r12      */
+        0x5B,                   /* pop rbx      */
+        0xC3                    /* ret          */
+    };
+    static const unsigned char cell_add_imm[] = { 0x80, 0x81, 0x83 };     /* add [rbx+disp32], imm         */
+    static const unsigned char cell_add_rax[] = { 0x00, 0x01, 0x83 };     /* add [rbx+disp32], rax         */
+    static const unsigned char cell_set_imm[] = { 0xC6, 0xC7, 0x83 };     /* mov [rbx+disp32], imm         */
+    static const unsigned char test_cell[] = { 0x80, 0x83, 0x3B };        /* cmp [rbx], imm8               */
+    static const unsigned char load_rax_byte[] = { 0x48, 0x0F, 0xB6, 0x03 }; /* movzx rax, byte [rbx]     */
+    static const unsigned char load_rax_word[] = { 0x48, 0x0F, 0xB7, 0x03 }; /* movzx rax, word [rbx]     */
+    static const unsigned char load_rax_dword[] = { 0x8B, 0x03 };         /* mov eax, dword [rbx]          */
+    static const unsigned char load_rax_qword[] = { 0x48, 0x8B, 0x03 };   /* mov rax, qword [rbx]          */
+    static const unsigned char move_imm[] = { 0x48, 0x81, 0xC3 };         /* add rbx, imm32                */
+    static const unsigned char move_rax[] = { 0x48, 0x01, 0xC3 };         /* add rbx, rax                  */
+    static const unsigned char load_rax_imm[] = { 0x48, 0xB8 };           /* mov rax, imm64                */
+    static const unsigned char load_rcx_imm[] = { 0x48, 0xB9 };           /* mov rcx, imm64                */
+    static const unsigned char mul_rax_imm[] = { 0x48, 0x69, 0xC0 };      /* imul rax, rax, imm32          */
+    static const unsigned char mul_rax_rcx[] = { 0x48, 0x0F, 0xAF, 0xC1 };/* imul rax, rcx                 */
+    static const unsigned char jump_zero[] = { 0x0F, 0x84 };              /* je rel32                      */
+    static const unsigned char jump_not_zero[] = { 0x0F, 0x85 };          /* jne rel32                     */
+    static const unsigned char load_rdi_cell[] = { 0x48, 0x89, 0xDF };    /* mov rdi, rbx                  */
+    static const unsigned char load_rsi_cell[] = { 0x48, 0x8D, 0xB3 };    /* lea rsi, [rbx+disp32]         */
+    static const unsigned char load_rsi_imm[] = { 0x48, 0xC7, 0xC6 };     /* mov rsi, imm32                */
+    static const unsigned char call_callback[] = { 0x41, 0xFF, 0x54, 0x24 }; /* call [r12+disp8]       */
+    static const unsigned char store_cell_rax[] = { 0x48, 0x89, 0xC3 };   /* mov rbx, rax                  */
+    static const unsigned char load_rdi_table[] = { 0x4C, 0x89, 0xE7 };   /* mov rdi, r12                  */
+    static const unsigned char load_rax_cell[] = { 0x48, 0x8D, 0x83 };    /* lea rax, [rbx+disp32]         */
+    static const unsigned char load_rcx_end[] = { 0x48, 0x8D, 0x8D };     /* lea rcx, [rbp+disp32]         */
+    static const unsigned char compare_rax_tape[] = { 0x48, 0x39, 0xE8 }; /* cmp rax, rbp                  */
+    static const unsigned char compare_rax_end[] = { 0x48, 0x39, 0xC8 };  /* cmp rax, rcx                  */
+    static const unsigned char jump_below[] = { 0x0F, 0x82 };             /* jb rel32                      */
+    static const unsigned char jump_above_equal[] = { 0x0F, 0x83 };       /* jae rel32                     */
+    static const unsigned char skip_zero[] = { 0x74 };                    /* je rel8                       */
+    static const unsigned char load_esi_imm[] = { 0xBE };                 /* mov esi, imm32                */
+    static const unsigned char jump[] = { 0xE9 };                         /* jmp rel32                     */
+    static const unsigned char load_rdx_cell[] = { 0x48, 0x89, 0xDA };    /* mov rdx, rbx                  */
+    static const unsigned char sub_rdx_tape[] = { 0x48, 0x29, 0xEA };     /* sub rdx, rbp                  */
+    static const unsigned char shift_rdx[] = { 0x48, 0xC1, 0xFA };        /* sar rdx, imm8                 */
+    static const unsigned char sub_steps[] = { 0x49, 0x81, 0x6C, 0x24 };  /* sub qword [r12+disp8], imm32  */
+    static const unsigned char jump_less[] = { 0x0F, 0x8C };              /* jl rel32                      */
+    static const unsigned char load_rax_table[] = { 0x49, 0x8B, 0x44, 0x24 }; /* mov rax, [r12+disp8]   */
+    static const unsigned char test_limit[] = { 0x83, 0xB8 };             /* cmp dword [rax+disp32], imm8  */
+    static const unsigned char test_result[] = { 0x85, 0xC0 };            /* test eax, eax                 */
+    size_t* starts = NULL;
+    size_t* patches = NULL;
+    const instruction_t* instruction = NULL;
+    size_t immediate_size = cell_size < 4 ? cell_size : 4;
+    size_t failure = 0;
+    long value = 0;
+    long target = 0;
+    index_t pc = 0;
+    int check_count = 0;
+    int loop_count = 0;
+    int error = 0;
+
+    (void) memset(buffer, 0, sizeof(jit_buffer_t));
+
+    /* The limit of the context is read as a 32-bit value */
+    if(limits && sizeof(sig_atomic_t) != 4) {
+        return -1;
+    }
+
+    starts = (size_t*) malloc((size_t) program->size * sizeof(size_t));
+    patches = (size_t*) malloc((size_t) program->size * sizeof(size_t));
+    if(!starts || !patches) {
+        perror("Memory error");
+        goto error;
+    }
+
+    error |= jit_emit(buffer, prologue, sizeof(prologue));
+
+    for(pc = 0; pc < program->size && !error; pc++) {
+        instruction = &program->code[pc];
+        starts[pc] = buffer->size;
+
+        /* Cells are addressed with a 32-bit displacement */
+        if((data_write_op != instruction->op &&
+            !JIT_IS_INT32(instruction->offset * (long) cell_size)) ||
+           ((cell_check_op == instruction->op || loop_check_op == instruction->op) &&
+            !JIT_IS_INT32(instruction->arg * (long) cell_size))) {
+            error = 1;
+            break;
+        }
+
+        switch(instruction->op) {
+        case cell_add_op:
+        case cell_muladd_op:
+            value = instruction->arg;
+            if(cell_muladd_op == instruction->op) {
+                /* Only the low bits of the product reach a narrow cell */
+                switch(cell_size) {
+                case 1:
+                    error |= jit_emit(buffer, load_rax_byte, sizeof(load_rax_byte));
+                    break;
+                case 2:
+                    error |= jit_emit(buffer, load_rax_word, sizeof(load_rax_word));
+                    break;
+                case 4:
+                    error |= jit_emit(buffer, load_rax_dword, sizeof(load_rax_dword));
+                    break;
+                default:
+                    error |= jit_emit(buffer, load_rax_qword, sizeof(load_rax_qword));
+                    break;
+                }
+                if(JIT_IS_INT32(value)) {
+                    error |= jit_emit(buffer, mul_rax_imm, sizeof(mul_rax_imm));
+                    error |= jit_emit_value(buffer, value, 4);
+                }
+                else {
+                    error |= jit_emit(buffer, load_rcx_imm, sizeof(load_rcx_imm));
+                    error |= jit_emit_value(buffer, value, 8);
+                    error |= jit_emit(buffer, mul_rax_rcx, sizeof(mul_rax_rcx));
+                }
+                error |= jit_emit_cell(buffer, cell_size, cell_add_rax);
+                error |= jit_emit_value(buffer, instruction->offset * (long) cell_size, 4);
+            }
+            else if(cell_size < 8 || JIT_IS_INT32(value)) {
+                /* Narrow cells keep the low bits of the operand */
+                error |= jit_emit_cell(buffer, cell_size, cell_add_imm);
+                error |= jit_emit_value(buffer, instruction->offset * (long) cell_size, 4);
+                error |= jit_emit_value(buffer, value, immediate_size);
+            }
+            else {
+                error |= jit_emit(buffer, load_rax_imm, sizeof(load_rax_imm));
+                error |= jit_emit_value(buffer, value, 8);
+                error |= jit_emit_cell(buffer, cell_size, cell_add_rax);
+                error |= jit_emit_value(buffer, instruction->offset * (long) cell_size, 4);
+            }
+            break;
+        case cell_move_op:
+            value = instruction->arg * (long) cell_size;
+            if(JIT_IS_INT32(value)) {
+                error |= jit_emit(buffer, move_imm, sizeof(move_imm));
+                error |= jit_emit_value(buffer, value, 4);
+            }
+            else {
+                error |= jit_emit(buffer, load_rax_imm, sizeof(load_rax_imm));
+                error |= jit_emit_value(buffer, value, 8);
+                error |= jit_emit(buffer, move_rax, sizeof(move_rax));
+            }
+            break;
+        case cell_clear_op:
+        case cell_set_op:
+            value = (cell_set_op == instruction->op) ? instruction->arg : 0;
+            target = instruction->offset * (long) cell_size;
+            error |= jit_emit_cell(buffer, cell_size, cell_set_imm);
+            error |= jit_emit_value(buffer, target, 4);
+            if(cell_size < 8 || JIT_IS_INT32(value)) {
+                error |= jit_emit_value(buffer, value, immediate_size);
+            }
+            else {
+                /* Cleared, then the 64-bit value is added */
+                error |= jit_emit_value(buffer, 0, immediate_size);
+                error |= jit_emit(buffer, load_rax_imm, sizeof(load_rax_imm));
+                error |= jit_emit_value(buffer, value, 8);
+                error |= jit_emit_cell(buffer, cell_size, cell_add_rax);
+                error |= jit_emit_value(buffer, target, 4);
+            }
+            break;
+        case data_output_op:
+        case data_input_op:
+            error |= jit_emit(buffer, load_rdi_table, sizeof(load_rdi_table));
+            error |= jit_emit(buffer, load_rsi_cell, sizeof(load_rsi_cell));
+            error |= jit_emit_value(buffer, instruction->offset * (long) cell_size, 4);
+            error |= jit_emit(buffer, call_callback, sizeof(call_callback));
+            error |= jit_emit_value(buffer,
+                                    data_output_op == instruction->op ?
+                                    (long) offsetof(jit_callbacks_t, data_output) :
+                                    (long) offsetof(jit_callbacks_t, data_input),
+                                    1);
+            if(limits && data_input_op == instruction->op) {
+                /* A read cut short by a limit returns (see jit_data_input) */
+                error |= jit_emit(buffer, test_result, sizeof(test_result));
+                error |= jit_emit(buffer, skip_zero, sizeof(skip_zero));
+                error |= jit_emit_value(buffer, (long) sizeof(epilogue), 1);
+                error |= jit_emit(buffer, epilogue, sizeof(epilogue));
+            }
+            break;
+        case cell_scan_op:
+            error |= jit_emit(buffer, load_rdi_cell, sizeof(load_rdi_cell));
+            error |= jit_emit(buffer, load_rsi_imm, sizeof(load_rsi_imm));
+            error |= jit_emit_value(buffer, instruction->arg, 4);
+            error |= jit_emit(buffer, call_callback, sizeof(call_callback));
+            error |= jit_emit_value(buffer, (long) offsetof(jit_callbacks_t, scan), 1);
+            error |= jit_emit(buffer, store_cell_rax, sizeof(store_cell_rax));
+            break;
+        case data_write_op:
+            error |= jit_emit(buffer, load_rdi_table, sizeof(load_rdi_table));
+            error |= jit_emit(buffer, load_rsi_imm, sizeof(load_rsi_imm));
+            error |= jit_emit_value(buffer, (long) pc, 4);
+            error |= jit_emit(buffer, call_callback, sizeof(call_callback));
+            error |= jit_emit_value(buffer, (long) offsetof(jit_callbacks_t, data_write), 1);
+            break;
+        case loop_end_op:
+            if(limits) {
+                /* Taken back-edges charge the length of the loop, then check */
+                /* the limit (the stubs are patched below)                    */
+                error |= jit_emit_cell(buffer, cell_size, test_cell);
+                error |= jit_emit_value(buffer, 0, 1);
+                error |= jit_emit(buffer, skip_zero, sizeof(skip_zero));
+                error |= jit_emit_value(buffer, 38, 1);
+                error |= jit_emit(buffer, sub_steps, sizeof(sub_steps));
+                error |= jit_emit_value(buffer, (long) offsetof(jit_callbacks_t, steps), 1);
+                error |= jit_emit_value(buffer, (long) (pc - instruction->jump + 1), 4);
+                error |= jit_emit(buffer, jump_less, sizeof(jump_less));
+                error |= jit_emit_value(buffer, 0, 4);
+                error |= jit_emit(buffer, load_rax_table, sizeof(load_rax_table));
+                error |= jit_emit_value(buffer, (long) offsetof(jit_callbacks_t, context), 1);
+                error |= jit_emit(buffer, test_limit, sizeof(test_limit));
+                error |= jit_emit_value(buffer, (long) offsetof(context_t, limit), 4);
+                error |= jit_emit_value(buffer, 0, 1);
+                error |= jit_emit(buffer, jump_not_zero, sizeof(jump_not_zero));
+                error |= jit_emit_value(buffer, 0, 4);
+                error |= jit_emit(buffer, jump, sizeof(jump));
+                patches[pc] = buffer->size;
+                error |= jit_emit_value(buffer, 0, 4);
+                loop_count++;
+                break;
+            }
+            /* Fall through */
+        case loop_begin_op:
+            error |= jit_emit_cell(buffer, cell_size, test_cell);
+            error |= jit_emit_value(buffer, 0, 1);
+            error |= jit_emit(buffer,
+                              loop_begin_op == instruction->op ? jump_zero : jump_not_zero,
+                              sizeof(jump_zero));
+            patches[pc] = buffer->size;
+            error |= jit_emit_value(buffer, 0, 4);
+            if(limits && loop_begin_op == instruction->op && LOOP_GUARD == instruction->arg) {
+                /* A rewritten loop is charged as one pass when entered */
+                error |= jit_emit(buffer, sub_steps, sizeof(sub_steps));
+                error |= jit_emit_value(buffer, (long) offsetof(jit_callbacks_t, steps), 1);
+                error |= jit_emit_value(buffer, (long) (instruction->jump - pc + 1), 4);
+                error |= jit_emit(buffer, jump_less, sizeof(jump_less));
+                error |= jit_emit_value(buffer, 0, 4);
+                error |= jit_emit(buffer, load_rax_table, sizeof(load_rax_table));
+                error |= jit_emit_value(buffer, (long) offsetof(jit_callbacks_t, context), 1);
+                error |= jit_emit(buffer, test_limit, sizeof(test_limit));
+                error |= jit_emit_value(buffer, (long) offsetof(context_t, limit), 4);
+                error |= jit_emit_value(buffer, 0, 1);
+                error |= jit_emit(buffer, jump_not_zero, sizeof(jump_not_zero));
+                error |= jit_emit_value(buffer, 0, 4);
+                loop_count++;
+            }
+            break;
+        case cell_check_op:
+        case loop_check_op:
+            if(loop_check_op == instruction->op) {
+                error |= jit_emit_cell(buffer, cell_size, test_cell);
+                error |= jit_emit_value(buffer, 0, 1);
+                error |= jit_emit(buffer, skip_zero, sizeof(skip_zero));
+                error |= jit_emit_value(buffer, 39, 1);
+            }
+            /* First and last cell within [rbp, rbp + STATIC_CELL_COUNT cells) */
+            error |= jit_emit(buffer, load_rax_cell, sizeof(load_rax_cell));
+            error |= jit_emit_value(buffer, instruction->offset * (long) cell_size, 4);
+            error |= jit_emit(buffer, compare_rax_tape, sizeof(compare_rax_tape));
+            error |= jit_emit(buffer, jump_below, sizeof(jump_below));
+            patches[pc] = buffer->size;
+            error |= jit_emit_value(buffer, 0, 4);
+            error |= jit_emit(buffer, load_rax_cell, sizeof(load_rax_cell));
+            error |= jit_emit_value(buffer, instruction->arg * (long) cell_size, 4);
+            error |= jit_emit(buffer, load_rcx_end, sizeof(load_rcx_end));
+            error |= jit_emit_value(buffer, STATIC_CELL_COUNT * (long) cell_size, 4);
+            error |= jit_emit(buffer, compare_rax_end, sizeof(compare_rax_end));
+            error |= jit_emit(buffer, jump_above_equal, sizeof(jump_above_equal));
+            error |= jit_emit_value(buffer, 0, 4);
+            check_count++;
+            break;
+        case end_op:
+            error |= jit_emit(buffer, epilogue, sizeof(epilogue));
+            break;
+        default:
+            /* Procedures are left to the interpreters */
+            error = 1;
+            break;
+        }
+    }
+
+    /* Failed checks: tape_error(callbacks, pc, current cell) and return */
+    if(check_count && !error) {
+        failure = buffer->size;
+        error |= jit_emit(buffer, load_rdi_table, sizeof(load_rdi_table));
+        error |= jit_emit(buffer, load_rdx_cell, sizeof(load_rdx_cell));
+        error |= jit_emit(buffer, sub_rdx_tape, sizeof(sub_rdx_tape));
+        for(value = 0; ((size_t) 1 << value) < cell_size; value++) {
+        }
+        if(value) {
+            error |= jit_emit(buffer, shift_rdx, sizeof(shift_rdx));
+            error |= jit_emit_value(buffer, value, 1);
+        }
+        error |= jit_emit(buffer, call_callback, sizeof(call_callback));
+        error |= jit_emit_value(buffer, (long) offsetof(jit_callbacks_t, tape_error), 1);
+        error |= jit_emit(buffer, epilogue, sizeof(epilogue));
+
+        for(pc = 0; pc < program->size && !error; pc++) {
+            instruction = &program->code[pc];
+            if(cell_check_op == instruction->op || loop_check_op == instruction->op) {
+                /* Both jumps of the check go to its stub */
+                target = (long) buffer->size;
+                jit_store_value(buffer->code + patches[pc], target - (long) (patches[pc] + 4), 4);
+                jit_store_value(buffer->code + patches[pc] + 23,
+                                target - (long) (patches[pc] + 27), 4);
+                error |= jit_emit(buffer, load_esi_imm, sizeof(load_esi_imm));
+                error |= jit_emit_value(buffer, (long) pc, 4);
+                error |= jit_emit(buffer, jump, sizeof(jump));
+                error |= jit_emit_value(buffer, (long) failure - (long) (buffer->size + 4), 4);
+            }
+        }
+    }
+
+    /* Limits: limit_reached(callbacks, pc) and return */
+    if(loop_count && !error) {
+        failure = buffer->size;
+        error |= jit_emit(buffer, load_rdi_table, sizeof(load_rdi_table));
+        error |= jit_emit(buffer, call_callback, sizeof(call_callback));
+        error |= jit_emit_value(buffer, (long) offsetof(jit_callbacks_t, limit_reached), 1);
+        error |= jit_emit(buffer, epilogue, sizeof(epilogue));
+
+        for(pc = 0; pc < program->size && !error; pc++) {
+            instruction = &program->code[pc];
+            if(loop_end_op == instruction->op ||
+               (loop_begin_op == instruction->op && LOOP_GUARD == instruction->arg)) {
+                /* Both jumps of the charge go to its stub (the charge is */
+                /* before the ']' jump or after the '[' jump)             */
+                value = loop_end_op == instruction->op ? -23 : 15;
+                target = (long) buffer->size;
+                jit_store_value(buffer->code + patches[pc] + value,
+                                target - (long) (patches[pc] + value + 4), 4);
+                jit_store_value(buffer->code + patches[pc] + value + 18,
+                                target - (long) (patches[pc] + value + 22), 4);
+                error |= jit_emit(buffer, load_esi_imm, sizeof(load_esi_imm));
+                error |= jit_emit_value(buffer, (long) pc, 4);
+                error |= jit_emit(buffer, jump, sizeof(jump));
+                error |= jit_emit_value(buffer, (long) failure - (long) (buffer->size + 4), 4);
+            }
+        }
+    }
+
+    if(error) {
+        goto error;
+    }
+
+    /* Both brackets jump to the instruction following their pair */
+    for(pc = 0; pc < program->size; pc++) {
+        instruction = &program->code[pc];
+        if(loop_begin_op == instruction->op || loop_end_op == instruction->op) {
+            target = (long) starts[instruction->jump + 1] - (long) (patches[pc] + 4);
+            jit_store_value(buffer->code + patches[pc], target, 4);
+        }
+    }
+
+    free(starts);
+    free(patches);
+    return 0;
+
+error:
+    free(starts);
+    free(patches);
+    free(buffer->code);
+    (void) memset(buffer, 0, sizeof(jit_buffer_t));
+    return -1;
+#undef JIT_IS_INT32
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: run_program_jit                                                  */
+/* Description: executes the compiled program as native x86-64 code           */
+/* Parameters: context - context of the run                                   */
+/*             program - compiled program                                     */
+/*             engine - engine of the selected cell type                      */
+/*             cells - tape                                                   */
+/* Return: 0 - executed (context->jit_result: 0 or -1 if a check failed or a  */
+/*         limit was reached);                                                */
+/*         -1 - native code is not available                                  */
+/* Note: the caller falls back to the interpreter on failure                  */
+/* -------------------------------------------------------------------------- */
+int run_program_jit(context_p context, const program_t* program,
+                    const cell_engine_t* engine, void* cells) {
+#if defined(USE_JIT)
+    jit_callbacks_t callbacks;
+    jit_buffer_t buffer;
+    jit_entry_t entry = NULL;
+    void* memory = NULL;
+
+    if(jit_compile(program, engine->bits / CHAR_BIT, context->steps > 0, &buffer)) {
+        return -1;
+    }
+
+    memory = mmap(NULL, buffer.size, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(MAP_FAILED == memory) {
+        free(buffer.code);
+        return -1;
+    }
+
+    (void) memcpy(memory, buffer.code, buffer.size);
+    free(buffer.code);
+
+    if(mprotect(memory, buffer.size, PROT_READ | PROT_EXEC)) {
+        (void) munmap(memory, buffer.size);
+        return -1;
+    }
+
+    callbacks.data_output = engine->jit_data_output;
+    callbacks.data_input = engine->jit_data_input;
+    callbacks.scan = engine->scan;
+    callbacks.data_write = jit_data_write;
+    callbacks.tape_error = jit_tape_error;
+    callbacks.limit_reached = jit_limit_reached;
+    callbacks.steps = context->steps;
+    callbacks.program = program;
+    callbacks.context = context;
+
+    /* ISO C has no conversion from object to function pointers */
+    (void) memcpy(&entry, &memory, sizeof(entry));
+    context->jit_result = 0;
+    entry(cells, &callbacks);
+    context->steps = callbacks.steps;
+
+    (void) munmap(memory, buffer.size);
+
+    return 0;
+#else
+    (void) context;
+    (void) program;
+    (void) engine;
+    (void) cells;
+
+    return -1;
+#endif /* defined(USE_JIT) */
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: execute_program                                                  */
+/* Description: runs a compiled program on the tape with its input and output */
+/* Parameters: context - context of the run (see init_context)                */
+/*             program - compiled program                                     */
+/*             engine - engine of the configured cell type                    */
+/*             tape - tape (cleared)                                          */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: input, output, trace, profile, procedures, snapshots and limits are  */
+/*       opened and closed here; the program is not changed, so threads may   */
+/*       run it at the same time with their own contexts and tapes            */
+/* -------------------------------------------------------------------------- */
+int execute_program(context_p context, const program_t* program,
+                    const cell_engine_t* engine, tape_p tape) {
+    const program_options_t* run_options = context->options;
+    int tracing = 0;
+    int result = 0;
+
+    if(input_open(context)) {
+        return -1;
+    }
+
+    if(output_open(context)) {
+        input_close(context);
+        return -1;
+    }
+
+    if((run_options->trace_filename[0] && trace_open(context)) ||
+       (run_options->profile && profile_open(context, program)) ||
+       procedure_open(context, program)) {
+        profile_close(context);
+        trace_close(context);
+        input_close(context);
+        (void) output_close(context);
+        return -1;
+    }
+
+#if defined(USE_POSIX_IO)
+    if(checkpoint_open(context, program, tape)) {
+        procedure_close(context);
+        profile_close(context);
+        trace_close(context);
+        input_close(context);
+        (void) output_close(context);
+        return -1;
+    }
+#endif /* defined(USE_POSIX_IO) */
+
+    if(limit_open(context)) {
+#if defined(USE_POSIX_IO)
+        checkpoint_close(context);
+#endif /* defined(USE_POSIX_IO) */
+        procedure_close(context);
+        profile_close(context);
+        trace_close(context);
+        input_close(context);
+        (void) output_close(context);
+        return -1;
+    }
+
+	if(run_options->verbose) {
+		(void) printf("Verbose mode!\n");
+        print_trace_legend();
 	}
 
-	fclose(file_code);
+    /* Tracing, profiling and snapshots need the switch engine */
+    tracing = run_options->verbose || run_options->trace_filename[0] || run_options->profile ||
+              run_options->checkpoint_interval || run_options->resume_filename[0];
+
+    if(tape->pages) {
+        /* Cells are found through the directory of pages */
+        result = engine->run_sparse(context, program, tape);
+    }
+    else if(run_options->jit && !tracing &&
+            !run_program_jit(context, program, engine, tape->cells)) {
+        /* Native code has been executed */
+        result = context->jit_result;
+    }
+    else if(threaded_engine == run_options->engine && !tracing) {
+        result = engine->run_threaded(context, program, tape->cells);
+    }
+    else {
+        result = engine->run(context, program, tape->cells);
+    }
+
+    limit_close(context);
+    if(context->limit) {
+        result = -1;
+    }
+
+#if defined(USE_POSIX_IO)
+    checkpoint_close(context);
+#endif /* defined(USE_POSIX_IO) */
+    procedure_close(context);
+    trace_close(context);
+    input_close(context);
+    if(output_close(context)) {
+        result = -1;
+    }
+
+    if(context->profile_counts) {
+        if(!result) {
+            print_profile(context, program);
+        }
+        profile_close(context);
+    }
+
+    return result ? -1 : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: vm_read                                                          */
+/* Description: reads input for a run of the VM from its input callback       */
+/* Parameters: user - VM (bfplus_vm_p)                                        */
+/*             data - buffer                                                  */
+/*             size - size of the buffer                                      */
+/* Return: count of bytes; 0 - end of input; -1 - error                       */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+long vm_read(void* user, unsigned char* data, unsigned long size) {
+    bfplus_vm_p vm = (bfplus_vm_p) user;
+
+    return vm->read(vm->user, data, size);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: vm_write                                                         */
+/* Description: writes output of a run of the VM to its output buffer or      */
+/*              its output callback                                           */
+/* Parameters: user - VM (bfplus_vm_p)                                        */
+/*             data - output                                                  */
+/*             size - size of the output                                      */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the part that fits is kept when the buffer is full (errno ENOSPC)    */
+/* -------------------------------------------------------------------------- */
+int vm_write(void* user, const unsigned char* data, unsigned long size) {
+    bfplus_vm_p vm = (bfplus_vm_p) user;
+    size_t count = (size_t) size;
+    int result = 0;
+
+    if(!vm->output) {
+        return vm->write(vm->user, data, size);
+    }
+
+    if(count > vm->output_capacity - vm->output_size) {
+        count = vm->output_capacity - vm->output_size;
+        errno = ENOSPC;
+        result = -1;
+    }
+
+    (void) memcpy(vm->output + vm->output_size, data, count);
+    vm->output_size += count;
+
+    return result;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_create_options                                            */
+/* Description: allocates the options of the library                          */
+/* Parameters: */
+/* Return: options or NULL (no memory)                                        */
+/* Note: the defaults are those of the interpreter without a configuration    */
+/* -------------------------------------------------------------------------- */
+bfplus_options_t* bfplus_create_options(void) {
+    bfplus_options_t* config = (bfplus_options_t*) malloc(sizeof(bfplus_options_t));
+
+    if(!config) {
+        perror("Memory error");
+        return NULL;
+    }
+
+    default_options(config);
+
+    return config;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_set_option                                                */
+/* Description: sets an option by its name                                    */
+/* Parameters: config - options                                               */
+/*             name - name of bf+.conf or "engine"                            */
+/*             value - value as in bf+.conf; switch, threaded or jit for the  */
+/*                     engine                                                 */
+/* Return: 0 - success; -1 - unknown name or engine                           */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int bfplus_set_option(bfplus_options_t* config, const char* name, const char* value) {
+    if(strcmp(name, PARAM_NAME_ENGINE)) {
+        return set_option(config, name, value);
+    }
+
+    if(!strcmp(value, ENGINE_NAME_SWITCH)) {
+        config->engine = switch_engine;
+        config->jit = 0;
+    }
+    else if(!strcmp(value, ENGINE_NAME_THREADED)) {
+        config->engine = threaded_engine;
+        config->jit = 0;
+    }
+    else if(!strcmp(value, ENGINE_NAME_JIT)) {
+        config->jit = 1;
+    }
+    else {
+        return -1;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_read_config                                               */
+/* Description: reads a configuration file into the options                   */
+/* Parameters: config - options                                               */
+/*             filename - configuration file name                             */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int bfplus_read_config(bfplus_options_t* config, const char* filename) {
+    return read_config_file(config, filename);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_destroy_options                                           */
+/* Description: releases the options                                          */
+/* Parameters: config - options (or NULL)                                     */
+/* Return: */
+/* Note: programs compiled with the options keep their own copy               */
+/* -------------------------------------------------------------------------- */
+void bfplus_destroy_options(bfplus_options_t* config) {
+    free(config);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_compile                                                   */
+/* Description: compiles and optimizes a program                              */
+/* Parameters: config - options of the language and of the engine             */
+/*             source - source text                                           */
+/*             size - size of the source in bytes                             */
+/* Return: program or NULL (failure)                                          */
+/* Note: the program is not changed by the runs, so VMs of several threads    */
+/*       may run it at the same time; the part before the first input is      */
+/*       evaluated (evaluate_prefix); with cache_directory a valid cache      */
+/*       file of the source and the options is mapped instead of compiling,   */
+/*       and a missing, stale or corrupt one is (re)written after compiling   */
+/* -------------------------------------------------------------------------- */
+bfplus_program_t* bfplus_compile(const bfplus_options_t* config,
+                                 const char* source, unsigned long size) {
+    bfplus_program_p program = (bfplus_program_p) calloc(1, sizeof(bfplus_program_t));
+#if defined(USE_POSIX_IO)
+    char filename[MAX_FILE_NAME_LENGTH + 32];
+    cache_header_t header;
+#endif /* defined(USE_POSIX_IO) */
+
+    if(!program) {
+        perror("Memory error");
+        return NULL;
+    }
+
+    program->options = *config;
+
+    program->engine = select_cell_engine(&program->options);
+    if(!program->engine) {
+        free(program);
+        return NULL;
+    }
+
+#if defined(USE_POSIX_IO)
+    if(program->options.cache_directory[0]) {
+        cache_prepare(&program->options, source, (long) size, &header, filename);
+        if(!cache_load(filename, &header, &program->program)) {
+            return program;
+        }
+    }
+#endif /* defined(USE_POSIX_IO) */
+
+    if(compile_program(&program->options, source, (long) size, &program->program)) {
+        free(program);
+        return NULL;
+    }
+
+    if(optimize_program(&program->program, program->engine) ||
+       evaluate_prefix(&program->program, &program->options, program->engine) ||
+       insert_tape_checks(&program->program, &program->options)) {
+        bfplus_destroy_program(program);
+        return NULL;
+    }
+
+#if defined(USE_POSIX_IO)
+    if(program->options.cache_directory[0]) {
+        (void) mkdir(program->options.cache_directory, 0777);
+        (void) cache_store(filename, &header, &program->program);
+    }
+#endif /* defined(USE_POSIX_IO) */
+
+    return program;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_compile_file                                              */
+/* Description: compiles and optimizes the program of a source file           */
+/* Parameters: config - options of the language and of the engine             */
+/*             filename - source file name                                    */
+/* Return: program or NULL (failure)                                          */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+bfplus_program_t* bfplus_compile_file(const bfplus_options_t* config, const char* filename) {
+    bfplus_program_p program = NULL;
+    char* source = NULL;
+    long source_size = 0;
+
+    if(load_source(filename, &source, &source_size)) {
+        return NULL;
+    }
+
+    program = bfplus_compile(config, source, (unsigned long) source_size);
+
+    free(source);
+
+    return program;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_destroy_program                                           */
+/* Description: releases a compiled program                                   */
+/* Parameters: program - program (or NULL)                                    */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void bfplus_destroy_program(bfplus_program_t* program) {
+    if(program) {
+        destroy_program(&program->program);
+        free(program);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_create_vm                                                 */
+/* Description: allocates a virtual machine                                   */
+/* Parameters: */
+/* Return: VM or NULL (no memory)                                             */
+/* Note: the tape is allocated by the first run                               */
+/* -------------------------------------------------------------------------- */
+bfplus_vm_t* bfplus_create_vm(void) {
+    bfplus_vm_p vm = (bfplus_vm_p) calloc(1, sizeof(bfplus_vm_t));
+
+    if(!vm) {
+        perror("Memory error");
+    }
+
+    return vm;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_set_callbacks                                             */
+/* Description: sets the input and output callbacks of the VM                 */
+/* Parameters: vm - VM                                                        */
+/*             read - input callback (or NULL)                                */
+/*             write - output callback (or NULL)                              */
+/*             user - argument of the callbacks                               */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void bfplus_set_callbacks(bfplus_vm_t* vm, bfplus_read_t read, bfplus_write_t write,
+                          void* user) {
+    vm->read = read;
+    vm->write = write;
+    vm->user = user;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_set_buffers                                               */
+/* Description: sets the input and output buffers of the VM                   */
+/* Parameters: vm - VM                                                        */
+/*             input - input (or NULL)                                        */
+/*             input_size - size of the input                                 */
+/*             output - output buffer (or NULL)                               */
+/*             output_capacity - size of the output buffer                    */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void bfplus_set_buffers(bfplus_vm_t* vm, const void* input, unsigned long input_size,
+                        void* output, unsigned long output_capacity) {
+    vm->input = (const unsigned char*) input;
+    vm->input_size = (size_t) input_size;
+    vm->output = (unsigned char*) output;
+    vm->output_capacity = (size_t) output_capacity;
+    vm->output_size = 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_set_files                                                 */
+/* Description: sets the input and output files of the VM                     */
+/* Parameters: vm - VM                                                        */
+/*             input_filename - input file ("" or NULL - standard input)      */
+/*             output_filename - output file ("" or NULL - standard output)   */
+/* Return: */
+/* Note: the names are copied (up to MAX_FILE_NAME_LENGTH - 1 characters)     */
+/* -------------------------------------------------------------------------- */
+void bfplus_set_files(bfplus_vm_t* vm, const char* input_filename,
+                      const char* output_filename) {
+    (void) strncpy(vm->input_filename, input_filename ? input_filename : "",
+                   MAX_FILE_NAME_LENGTH - 1);
+    (void) strncpy(vm->output_filename, output_filename ? output_filename : "",
+                   MAX_FILE_NAME_LENGTH - 1);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_run                                                       */
+/* Description: runs a compiled program on the VM                             */
+/* Parameters: vm - VM                                                        */
+/*             program - compiled program                                     */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the tape is reused when the cell size, use_infinite_cells and        */
+/*       use_sparse_cells of the program are those of the previous run, and   */
+/*       cleared if it was used; the input is taken from the buffer, the      */
+/*       callback or the file, the output goes to the buffer, the callback or */
+/*       the file, in this order                                              */
+/* -------------------------------------------------------------------------- */
+int bfplus_run(bfplus_vm_t* vm, const bfplus_program_t* program) {
+    size_t cell_size = program->engine->bits / CHAR_BIT;
+    unsigned char is_infinite = program->options.use_infinite_cells ? 1 : 0;
+    unsigned char is_sparse = program->options.use_sparse_cells ? 1 : 0;
+
+    if(vm->cell_size != cell_size || vm->is_infinite != is_infinite ||
+       vm->is_sparse != is_sparse) {
+        if(vm->cell_size) {
+            destroy_tape(&vm->tape);
+            vm->cell_size = 0;
+        }
+        if(create_tape(&vm->tape, cell_size, is_infinite, is_sparse)) {
+            return -1;
+        }
+        vm->cell_size = cell_size;
+        vm->is_infinite = is_infinite;
+        vm->is_sparse = is_sparse;
+    }
+    else if(vm->is_dirty) {
+        clear_tape(&vm->tape);
+    }
+    vm->is_dirty = 1;
+
+    init_context(&vm->context, &program->options, vm->input_filename, vm->output_filename);
+    vm->context.input_data = vm->input;
+    vm->context.input_size = vm->input_size;
+    vm->context.read = vm->read ? vm_read : NULL;
+    vm->context.write = (vm->output || vm->write) ? vm_write : NULL;
+    vm->context.user = vm;
+    vm->output_size = 0;
+
+    return execute_program(&vm->context, &program->program, program->engine, &vm->tape);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_output_size                                               */
+/* Description: size of the output written to the buffer by the last run      */
+/* Parameters: vm - VM                                                        */
+/* Return: count of bytes                                                     */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+unsigned long bfplus_output_size(const bfplus_vm_t* vm) {
+    return (unsigned long) vm->output_size;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: bfplus_destroy_vm                                                */
+/* Description: releases a virtual machine and its tape                       */
+/* Parameters: vm - VM (or NULL)                                              */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void bfplus_destroy_vm(bfplus_vm_t* vm) {
+    if(vm) {
+        if(vm->cell_size) {
+            destroy_tape(&vm->tape);
+        }
+        free(vm);
+    }
+}
+
+#if !defined(BFPLUS_LIBRARY)
+/* -------------------------------------------------------------------------- */
+/* Function: emit_c_program                                                   */
+/* Description: writes the compiled program as a standalone C program         */
+/* Parameters: program - compiled program                                     */
+/*             engine - engine of the selected cell type                      */
+/*             file - output file                                             */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: the generated code is C90 and bakes in the configured semantics;     */
+/*       only the helpers and variables it uses are written (no warnings)     */
+/* -------------------------------------------------------------------------- */
+int emit_c_program(const program_t* program, const cell_engine_t* engine, FILE* file) {
+    const instruction_t* instruction = NULL;
+    int use_data_output = 0;
+    int use_data_input = 0;
+    int use_data_write = 0;
+    int use_tape_check = 0;
+    int use_cells = 0;
+    int depth = 1;
+    index_t pc = 0;
+    long i = 0;
+
+    for(pc = 0; pc < program->size; pc++) {
+        use_data_output |= (data_output_op == program->code[pc].op);
+        use_data_input |= (data_input_op == program->code[pc].op);
+        use_data_write |= (data_write_op == program->code[pc].op);
+        use_tape_check |= (cell_check_op == program->code[pc].op ||
+                           loop_check_op == program->code[pc].op);
+        use_cells |= (data_write_op != program->code[pc].op &&
+                      end_op != program->code[pc].op);
+    }
+
+    (void) fprintf(file, "/* Generated by Brainfuck Interpreter Plus (bf+) %s */\n", PROGRAM_VERSION);
+    (void) fprintf(file, "/* Source: %s */\n\n", options.source_filename);
+    (void) fprintf(file, "#include <stdlib.h>\n#include <stdio.h>\n\n");
+    (void) fprintf(file, "#define STATIC_CELL_COUNT %d\n\n", STATIC_CELL_COUNT);
+    (void) fprintf(file, "typedef %s cell_t, *cell_p;\n\n", engine->type_name);
+
+    if(use_data_write) {
+        (void) fprintf(file, "static const unsigned char data[] = {");
+        for(i = 0; i < program->data_size; i++) {
+            (void) fprintf(file, "%s%s%d",
+                           i ? "," : "",
+                           (i % 16) ? " " : "\n    ",
+                           program->data[i]);
+        }
+        (void) fprintf(file, "\n};\n\n");
+    }
+
+    if(use_data_output) {
+        (void) fprintf(file, "static void data_output(cell_t value) {\n");
+        if(options.use_mod255) {
+            (void) fprintf(file, "    int ch = (int) (value %% 256);\n\n");
+            (void) fprintf(file, "    if(ch < 0) {\n        ch += 256;\n    }\n\n");
+        }
+        else {
+            (void) fprintf(file, "    int ch = (unsigned char) value;\n\n");
+        }
+        if(options.use_force_rn) {
+            (void) fprintf(file, "    if('\\n' == ch) {\n        (void) fputc('\\r', stdout);\n    }\n\n");
+        }
+        (void) fprintf(file, "    (void) fputc(ch, stdout);\n");
+        (void) fprintf(file, "}\n\n");
+    }
+
+    if(use_data_input && minus_one_eof != options.eof_value) {
+        (void) fprintf(file, "static cell_t data_input(%s) {\n",
+                       zero_eof == options.eof_value ? "void" : "cell_t value");
+        (void) fprintf(file, "    int ch = fgetc(stdin);\n\n");
+        (void) fprintf(file, "    return EOF == ch ? %s : (cell_t) ch;\n",
+                       zero_eof == options.eof_value ? "0" : "value");
+        (void) fprintf(file, "}\n\n");
+    }
+
+    if(use_tape_check) {
+        (void) fprintf(file, "static void tape_check(long cell, long first, long last) {\n");
+        (void) fprintf(file, "    if(cell + first < 0 || cell + last >= STATIC_CELL_COUNT) {\n");
+        (void) fprintf(file, "        (void) fprintf(stderr, \"Tape error: cell %%ld is outside "
+                             "the tape (0-%%d)\\n\",\n");
+        (void) fprintf(file, "                       cell + first < 0 ? cell + first : cell + last, "
+                             "STATIC_CELL_COUNT - 1);\n");
+        (void) fprintf(file, "        exit(EXIT_FAILURE);\n    }\n");
+        (void) fprintf(file, "}\n\n");
+    }
+
+    (void) fprintf(file, "int main(void) {\n");
+    (void) fprintf(file, "    cell_p cells = (cell_p) calloc(STATIC_CELL_COUNT, sizeof(cell_t));\n");
+    if(use_cells) {
+        (void) fprintf(file, "    cell_p p = cells;\n");
+    }
+    (void) fprintf(file, "\n");
+    (void) fprintf(file, "    if(!cells) {\n        perror(\"Memory error\");\n        return EXIT_FAILURE;\n    }\n\n");
+
+    for(pc = 0; pc < program->size; pc++) {
+        instruction = &program->code[pc];
+
+        if(loop_end_op == instruction->op) {
+            depth--;
+        }
+
+        if(end_op != instruction->op) {
+            (void) fprintf(file, "%*s", depth * 4, "");
+        }
+
+        switch(instruction->op) {
+        case cell_add_op:
+            (void) fprintf(file, "p[%ldL] += %ldL;\n", instruction->offset, instruction->arg);
+            break;
+        case cell_move_op:
+            (void) fprintf(file, "p += %ldL;\n", instruction->arg);
+            break;
+        case cell_clear_op:
+            (void) fprintf(file, "p[%ldL] = 0;\n", instruction->offset);
+            break;
+        case cell_set_op:
+            (void) fprintf(file, "p[%ldL] = (cell_t) %ldL;\n", instruction->offset, instruction->arg);
+            break;
+        case cell_muladd_op:
+            (void) fprintf(file, "p[%ldL] += *p * %ldL;\n", instruction->offset, instruction->arg);
+            break;
+        case cell_scan_op:
+            (void) fprintf(file, "while(*p) {\n%*sp += %ldL;\n%*s}\n",
+                           depth * 4 + 4, "", instruction->arg, depth * 4, "");
+            break;
+        case data_output_op:
+            (void) fprintf(file, "data_output(p[%ldL]);\n", instruction->offset);
+            break;
+        case data_input_op:
+            if(minus_one_eof == options.eof_value) {
+                (void) fprintf(file, "p[%ldL] = (cell_t) fgetc(stdin);\n", instruction->offset);
+            }
+            else if(zero_eof == options.eof_value) {
+                (void) fprintf(file, "p[%ldL] = data_input();\n", instruction->offset);
+            }
+            else {
+                (void) fprintf(file, "p[%ldL] = data_input(p[%ldL]);\n",
+                               instruction->offset, instruction->offset);
+            }
+            break;
+        case loop_begin_op:
+            (void) fprintf(file, "while(*p) {\n");
+            depth++;
+            break;
+        case loop_end_op:
+            (void) fprintf(file, "}\n");
+            break;
+        case data_write_op:
+            (void) fprintf(file, "(void) fwrite(data + %ld, 1, %ld, stdout);\n",
+                           instruction->offset, instruction->arg);
+            break;
+        case cell_check_op:
+        case loop_check_op:
+            (void) fprintf(file, "%stape_check((long) (p - cells), %ldL, %ldL);\n",
+                           loop_check_op == instruction->op ? "if(*p) " : "",
+                           instruction->offset, instruction->arg);
+            break;
+        default:
+            break;
+        }
+    }
+
+    (void) fprintf(file, "\n    free(cells);\n\n");
+    (void) fprintf(file, "    return EXIT_SUCCESS;\n");
+    (void) fprintf(file, "}\n");
+
+    return ferror(file) ? -1 : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: emit_c                                                           */
+/* Description: writes the compiled program as C to options.emit_c_filename   */
+/* Parameters: program - compiled program                                     */
+/*             engine - engine of the selected cell type                      */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: "-" means standard output; programs with procedures are not          */
+/*       supported, nor the infinite and sparse tapes (the emitted program    */
+/*       has the fixed tape of STATIC_CELL_COUNT cells)                       */
+/* -------------------------------------------------------------------------- */
+int emit_c(const program_t* program, const cell_engine_t* engine) {
+    FILE* file = stdout;
+    index_t pc = 0;
+    int result = 0;
+
+    if(options.use_infinite_cells || options.use_sparse_cells) {
+        (void) fprintf(stderr, "Emit error: use_infinite_cells and use_sparse_cells are not "
+                       "supported\n");
+        return -1;
+    }
+
+    for(pc = 0; pc < program->size; pc++) {
+        if(procedure_begin_op == program->code[pc].op || procedure_call_op == program->code[pc].op) {
+            (void) fprintf(stderr, "Emit error: procedures are not supported\n");
+            return -1;
+        }
+    }
+
+    if(strcmp(options.emit_c_filename, "-")) {
+        if((file = fopen(options.emit_c_filename, "w")) == NULL) {
+            perror("File not open");
+            return -1;
+        }
+    }
+
+    result = emit_c_program(program, engine, file);
+    if(result) {
+        perror("File write error");
+    }
 
-	if(cells) {
-		free(cells);
-		cells = NULL;
+    if(stdout != file) {
+        if(fclose(file)) {
+            perror("File write error");
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: control                                                          */
+/* Description: */
+/* Parameters: */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+int control(void) {
+	if(!options.source_filename[0] && !options.batch_filename[0]) {
+		return -1;
 	}
 
-	return EXIT_SUCCESS;
+    if(options.jobs > 1 && (options.trace_filename[0] || options.profile || options.verbose)) {
+        (void) fprintf(stderr, "--trace, --profile and --verbose need --jobs 1\n");
+        return -1;
+    }
+
+    if((options.checkpoint_interval || options.resume_filename[0]) &&
+       (options.batch_filename[0] || options.emit_c_filename[0])) {
+        (void) fprintf(stderr, "--checkpoint-every and --resume need a single run\n");
+        return -1;
+    }
+
+    /* One timer per process */
+    if(options.jobs > 1 && options.max_time) {
+        (void) fprintf(stderr, "--max-time needs --jobs 1\n");
+        return -1;
+    }
+
+#if !defined(USE_POSIX_IO)
+    if(options.checkpoint_interval || options.resume_filename[0]) {
+        (void) fprintf(stderr, "--checkpoint-every and --resume are not supported\n");
+        return -1;
+    }
+
+    if(options.max_time) {
+        (void) fprintf(stderr, "--max-time is not supported\n");
+        return -1;
+    }
+#endif /* !defined(USE_POSIX_IO) */
+
+	return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: work                                                             */
+/* Description: compiles the source file and runs it (or emits it as C)       */
+/* Parameters: */
+/* Return: EXIT_SUCCESS - success; EXIT_FAILURE - failure;                    */
+/*         LIMIT_EXIT_STATUS - the run reached a limit                        */
+/* Note: a client of the library: one program run once on one VM              */
+/* -------------------------------------------------------------------------- */
+int work(void) {
+    bfplus_program_p program = NULL;
+    bfplus_vm_p vm = NULL;
+    int result = EXIT_FAILURE;
+
+    if(options.show_info) {
+        print_show_information();
+    }
+
+    program = bfplus_compile_file(&options, options.source_filename);
+    if(!program) {
+        return EXIT_FAILURE;
+    }
+
+    if(options.emit_c_filename[0]) {
+        result = emit_c(&program->program, program->engine) ? EXIT_FAILURE : EXIT_SUCCESS;
+        bfplus_destroy_program(program);
+        return result;
+    }
+
+    vm = bfplus_create_vm();
+    if(vm) {
+        bfplus_set_files(vm, options.input_filename, options.output_filename);
+        main_context = &vm->context;
+
+        if(bfplus_run(vm, program)) {
+            result = vm->context.limit ? LIMIT_EXIT_STATUS : EXIT_FAILURE;
+        }
+        else {
+            result = EXIT_SUCCESS;
+        }
+
+        main_context = NULL;
+        bfplus_destroy_vm(vm);
+    }
+
+    bfplus_destroy_program(program);
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: batch_clock                                                      */
+/* Description: current time for the job timings                              */
+/* Parameters: */
+/* Return: time in seconds                                                    */
+/* Note: wall time with POSIX, processor time otherwise                       */
+/* -------------------------------------------------------------------------- */
+double batch_clock(void) {
+#if defined(USE_POSIX_IO)
+    struct timeval now;
+
+    (void) gettimeofday(&now, NULL);
+
+    return (double) now.tv_sec + (double) now.tv_usec / 1e6;
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif /* defined(USE_POSIX_IO) */
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: batch_parse                                                      */
+/* Description: splits the manifest into jobs                                 */
+/* Parameters: text - manifest text (modified: names are terminated in place) */
+/*             size - size of the text                                        */
+/*             jobs - allocated array of jobs (out)                           */
+/*             count - number of jobs (out)                                   */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: one job per line: source [input [output]] separated by blanks;       */
+/*       "-" (or nothing) is the standard input or output; empty lines and    */
+/*       lines starting with '#' are skipped; the text must have room for a   */
+/*       terminating zero (load_source always leaves it)                      */
+/* -------------------------------------------------------------------------- */
+int batch_parse(char* text, long size, batch_job_p* jobs, long* count) {
+    static const char* const standard = "-";
+    const char* fields[3];
+    batch_job_p job = NULL;
+    char* line = text;
+    char* next = NULL;
+    long capacity = 1;
+    long line_number = 0;
+    long i = 0;
+    int field_count = 0;
+
+    text[size] = '\0';
+
+    for(i = 0; i < size; i++) {
+        if('\n' == text[i]) {
+            capacity++;
+        }
+    }
+
+    *count = 0;
+    *jobs = (batch_job_p) calloc((size_t) capacity, sizeof(batch_job_t));
+    if(!*jobs) {
+        perror("Memory error");
+        return -1;
+    }
+
+    for(; line; line = next) {
+        line_number++;
+        next = strchr(line, '\n');
+        if(next) {
+            *next++ = '\0';
+        }
+
+        field_count = 0;
+        while(*line) {
+            while(' ' == *line || '\t' == *line || '\r' == *line) {
+                *line++ = '\0';
+            }
+            if(!*line || ('#' == *line && !field_count)) {
+                break;
+            }
+            if(field_count == 3) {
+                (void) fprintf(stderr, "Batch error: line %ld: more than 3 fields\n", line_number);
+                free(*jobs);
+                *jobs = NULL;
+                return -1;
+            }
+            fields[field_count++] = line;
+            while(*line && ' ' != *line && '\t' != *line && '\r' != *line) {
+                line++;
+            }
+        }
+
+        if(!field_count) {
+            continue;
+        }
+
+        job = &(*jobs)[(*count)++];
+        job->source = fields[0];
+        job->input = field_count > 1 ? fields[1] : standard;
+        job->output = field_count > 2 ? fields[2] : standard;
+        job->line = line_number;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: batch_find_program                                               */
+/* Description: finds the entry of a source file in the table of programs     */
+/* Parameters: table - open addressing hash table                             */
+/*             mask - size of the table minus one (size is a power of two)    */
+/*             source - source file name                                      */
+/* Return: entry of the source or the free entry for it                       */
+/* Note: the table has more entries than jobs, so a free entry exists         */
+/* -------------------------------------------------------------------------- */
+batch_program_p batch_find_program(batch_program_p table, unsigned long mask,
+                                   const char* source) {
+    unsigned long hash = 5381;
+    const unsigned char* ch = (const unsigned char*) source;
+
+    for(; *ch; ch++) {
+        hash = hash * 33 + *ch;
+    }
+
+    for(hash &= mask; table[hash].source; hash = (hash + 1) & mask) {
+        if(!strcmp(table[hash].source, source)) {
+            break;
+        }
+    }
+
+    return &table[hash];
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: batch_next_job                                                   */
+/* Description: takes the next job of a worker                                */
+/* Parameters: worker - worker of the batch mode                              */
+/* Return: job or NULL (no jobs left)                                         */
+/* Note: the worker takes its jobs from the front of its range; with an empty */
+/*       range it steals the back half of the range of the next worker that   */
+/*       has jobs left, so neighbouring jobs stay on one worker               */
+/* -------------------------------------------------------------------------- */
+batch_job_p batch_next_job(batch_worker_p worker) {
+    batch_p batch = worker->batch;
+    batch_worker_p victim = NULL;
+    unsigned int index = (unsigned int) (worker - batch->workers);
+    unsigned int i = 0;
+    long job = -1;
+    long half = 0;
+
+    BATCH_LOCK(worker);
+    if(worker->begin < worker->end) {
+        job = worker->begin++;
+    }
+    BATCH_UNLOCK(worker);
+
+    for(i = 1; job < 0 && i < batch->worker_count; i++) {
+        victim = &batch->workers[(index + i) % batch->worker_count];
+
+        BATCH_LOCK(victim);
+        if(victim->begin < victim->end) {
+            half = (victim->end - victim->begin + 1) / 2;
+            victim->end -= half;
+            job = victim->end;
+        }
+        BATCH_UNLOCK(victim);
+
+        if(job >= 0) {
+            /* Only the owner adds jobs to its (empty) range */
+            BATCH_LOCK(worker);
+            worker->begin = job + 1;
+            worker->end = job + half;
+            BATCH_UNLOCK(worker);
+            worker->steals++;
+        }
+    }
+
+    return job < 0 ? NULL : &batch->jobs[job];
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: batch_run_jobs                                                   */
+/* Description: runs jobs until none is left (thread of a worker)             */
+/* Parameters: data - worker of the batch mode (batch_worker_p)               */
+/* Return: NULL                                                               */
+/* Note: the compiled programs are shared, the VM (tape, input, output)       */
+/*       belongs to the worker and clears its tape between the jobs           */
+/* -------------------------------------------------------------------------- */
+void* batch_run_jobs(void* data) {
+    batch_worker_p worker = (batch_worker_p) data;
+    batch_job_p job = NULL;
+    double start = 0.0;
+
+    while((job = batch_next_job(worker)) != NULL) {
+        start = batch_clock();
+
+        job->status = -1;
+        if(job->program->program) {
+            bfplus_set_files(worker->vm,
+                             strcmp(job->input, "-") ? job->input : "",
+                             strcmp(job->output, "-") ? job->output : "");
+            job->status = bfplus_run(worker->vm, job->program->program);
+        }
+
+        job->seconds = batch_clock() - start;
+    }
+
+    return NULL;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: batch                                                            */
+/* Description: runs the jobs of the batch manifest on a pool of workers      */
+/* Parameters: */
+/* Return: EXIT_SUCCESS - all jobs succeeded; EXIT_FAILURE - otherwise        */
+/* Note: the configuration is read once and each source file is compiled     */
+/*       once before the jobs run; --jobs workers (threads) share the         */
+/*       compiled programs, each runs them on its own VM (tape, input and     */
+/*       output buffers); jobs writing to the standard output may interleave  */
+/*       in blocks of output_buffer_size bytes; the status and the wall time  */
+/*       of every job are printed to the standard error at the end; --input,  */
+/*       --output and --emit-c are not used                                   */
+/* -------------------------------------------------------------------------- */
+int batch(void) {
+    batch_t state;
+    batch_job_p jobs = NULL;
+    batch_job_p job = NULL;
+    batch_program_p programs = NULL;
+    batch_program_p entry = NULL;
+    batch_worker_p workers = NULL;
+    batch_worker_p worker = NULL;
+    char* manifest = NULL;
+    long manifest_size = 0;
+    long count = 0;
+    long compiled = 0;
+    long failed = 0;
+    long steals = 0;
+    long i = 0;
+    unsigned long mask = 1;
+    unsigned int worker_count = 0;
+    unsigned int created = 0;
+    unsigned int w = 0;
+    int result = EXIT_FAILURE;
+    double start = 0.0;
+
+    (void) memset(&state, 0, sizeof(batch_t));
+
+    if(options.show_info) {
+        print_show_information();
+    }
+
+    if(load_source(options.batch_filename, &manifest, &manifest_size)) {
+        return EXIT_FAILURE;
+    }
+
+    if(batch_parse(manifest, manifest_size, &jobs, &count)) {
+        free(manifest);
+        return EXIT_FAILURE;
+    }
+
+    while(mask < (unsigned long) count * 2) {
+        mask <<= 1;
+    }
+    mask--;
+
+    worker_count = (long) options.jobs < count ? options.jobs : (unsigned int) count;
+    if(!worker_count) {
+        worker_count = 1;
+    }
+
+    programs = (batch_program_p) calloc((size_t) mask + 1, sizeof(batch_program_t));
+    workers = (batch_worker_p) calloc((size_t) worker_count, sizeof(batch_worker_t));
+    if(!programs || !workers) {
+        perror("Memory error");
+        goto done;
+    }
+
+    /* The programs are not changed after this loop */
+    for(i = 0; i < count; i++) {
+        job = &jobs[i];
+        entry = batch_find_program(programs, mask, job->source);
+        if(!entry->source) {
+            entry->source = job->source;
+            entry->program = bfplus_compile_file(&options, job->source);
+            compiled++;
+        }
+        job->program = entry;
+    }
+
+    state.jobs = jobs;
+    state.workers = workers;
+    state.worker_count = worker_count;
+
+    for(w = 0; w < worker_count; w++) {
+        worker = &workers[w];
+        worker->batch = &state;
+        worker->begin = count * (long) w / (long) worker_count;
+        worker->end = count * (long) (w + 1) / (long) worker_count;
+        worker->vm = bfplus_create_vm();
+        if(!worker->vm) {
+            goto done;
+        }
+        created++;
+#if defined(USE_THREADS)
+        (void) pthread_mutex_init(&worker->lock, NULL);
+#endif /* defined(USE_THREADS) */
+    }
+
+    start = batch_clock();
+
+    /* The main thread is worker 0; the jobs of a worker without a thread are */
+    /* stolen by the others                                                   */
+#if defined(USE_THREADS)
+    for(w = 1; w < worker_count; w++) {
+        worker = &workers[w];
+        if(pthread_create(&worker->thread, NULL, batch_run_jobs, worker)) {
+            perror("Thread error");
+        }
+        else {
+            worker->is_started = 1;
+        }
+    }
+#endif /* defined(USE_THREADS) */
+
+    if(1 == worker_count) {
+        main_context = &workers[0].vm->context;
+    }
+
+    (void) batch_run_jobs(&workers[0]);
+
+    main_context = NULL;
+
+#if defined(USE_THREADS)
+    for(w = 1; w < worker_count; w++) {
+        if(workers[w].is_started) {
+            (void) pthread_join(workers[w].thread, NULL);
+        }
+    }
+#endif /* defined(USE_THREADS) */
+
+    for(w = 0; w < worker_count; w++) {
+        steals += workers[w].steals;
+    }
+
+    (void) fprintf(stderr, "%8s %6s %12s  %s\n", "line", "status", "seconds", "source");
+    for(i = 0; i < count; i++) {
+        job = &jobs[i];
+        if(job->status) {
+            failed++;
+        }
+        (void) fprintf(stderr, "%8ld %6s %12.6f  %s\n", job->line,
+                       job->status ? "failed" : "ok", job->seconds, job->source);
+    }
+    (void) fprintf(stderr, "Batch: %ld jobs, %ld failed, %ld programs compiled, "
+                   "%u workers, %ld steals, %.6f seconds\n",
+                   count, failed, compiled, worker_count, steals, batch_clock() - start);
+
+    result = failed ? EXIT_FAILURE : EXIT_SUCCESS;
+
+done:
+    for(w = 0; w < created; w++) {
+#if defined(USE_THREADS)
+        (void) pthread_mutex_destroy(&workers[w].lock);
+#endif /* defined(USE_THREADS) */
+        bfplus_destroy_vm(workers[w].vm);
+    }
+
+    if(programs) {
+        for(i = 0; i <= (long) mask; i++) {
+            bfplus_destroy_program(programs[i].program);
+        }
+    }
+
+    free(workers);
+    free(programs);
+    free(jobs);
+    free(manifest);
+
+    return result;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -967,10 +7563,27 @@ int work(void) {
 /* Note: none                                                                 */
 /* -------------------------------------------------------------------------- */
 int main(const int argc, char* const* argv) {
-    const char* short_options = "c:f:svqplhVa";
+    const char* short_options = "c:f:i:o:b:J:k:e:jC:t:D:E:R:m:T:O:PSsvqplhVa";
 	const struct option long_options[] = {
         { "config",         required_argument, NULL, 'c' },
         { "file",           required_argument, NULL, 'f' },
+        { "input",          required_argument, NULL, 'i' },
+        { "output",         required_argument, NULL, 'o' },
+        { "batch",          required_argument, NULL, 'b' },
+        { "jobs",           required_argument, NULL, 'J' },
+        { "cache",          required_argument, NULL, 'k' },
+        { "engine",         required_argument, NULL, 'e' },
+        { "jit",            no_argument,       NULL, 'j' },
+        { "emit-c",         required_argument, NULL, 'C' },
+        { "trace",          required_argument, NULL, 't' },
+        { "decode-trace",   required_argument, NULL, 'D' },
+        { "checkpoint-every", required_argument, NULL, 'E' },
+        { "resume",         required_argument, NULL, 'R' },
+        { "max-steps",      required_argument, NULL, 'm' },
+        { "max-time",       required_argument, NULL, 'T' },
+        { "max-output",     required_argument, NULL, 'O' },
+        { "profile",        no_argument,       NULL, 'P' },
+        { "safe",           no_argument,       NULL, 'S' },
         { "show-info",      no_argument,       NULL, 's' },
         { "verbose",        no_argument,       NULL, 'v' },
         { "quiet-exit",     no_argument,       NULL, 'q' },
@@ -983,6 +7596,11 @@ int main(const int argc, char* const* argv) {
 	};
 	int result_option = 0;
 	int index_option = 0;
+	char* end_of_number = NULL;
+	long number = 0;
+    double seconds = 0;
+    int safe = 0;
+    const char* cache = NULL;
 	extern char* optarg; /* in getopt.h */
 
 	if(atexit(atexit_func)) {
@@ -990,7 +7608,7 @@ int main(const int argc, char* const* argv) {
 		return EXIT_FAILURE;
 	}	
 
-    (void) memset(&options, 0, sizeof(program_options_t));
+    default_options(&options);
 
 	if(argc > 1) {
 		while((result_option = getopt_long(argc, argv, short_options, long_options, &index_option)) != -1) {
@@ -1001,6 +7619,100 @@ int main(const int argc, char* const* argv) {
             case 'f':
                 (void) strncpy(options.source_filename, optarg, MAX_FILE_NAME_LENGTH);
                 break;
+            case 'i':
+                (void) strncpy(options.input_filename, optarg, MAX_FILE_NAME_LENGTH);
+                break;
+            case 'o':
+                (void) strncpy(options.output_filename, optarg, MAX_FILE_NAME_LENGTH);
+                break;
+            case 'b':
+                (void) strncpy(options.batch_filename, optarg, MAX_FILE_NAME_LENGTH);
+                break;
+            case 'J':
+                number = strtol(optarg, &end_of_number, 10);
+                if(*end_of_number || number < 1 || number > MAX_JOB_COUNT) {
+                    (void) fprintf(stderr, "Invalid number of jobs: %s (1..%d)\n",
+                                   optarg, MAX_JOB_COUNT);
+                    return EXIT_FAILURE;
+                }
+                options.jobs = (unsigned int) number;
+                break;
+            case 'k':
+                cache = optarg;
+                break;
+            case 'e':
+                if(!strcmp(optarg, ENGINE_NAME_SWITCH)) {
+                    options.engine = switch_engine;
+                }
+                else if(!strcmp(optarg, ENGINE_NAME_THREADED)) {
+                    options.engine = threaded_engine;
+                }
+                else {
+                    (void) fprintf(stderr, "Unknown engine: %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'j':
+                options.jit = 1;
+                break;
+            case 'C':
+                (void) strncpy(options.emit_c_filename, optarg, MAX_FILE_NAME_LENGTH);
+                if(!strcmp(options.emit_c_filename, "-")) {
+                    options.quiet_exit = 1;
+                }
+                break;
+            case 't':
+                (void) strncpy(options.trace_filename, optarg, MAX_FILE_NAME_LENGTH);
+                break;
+            case 'D':
+                (void) strncpy(options.decode_trace_filename, optarg, MAX_FILE_NAME_LENGTH);
+                options.quiet_exit = 1;
+                break;
+            case 'E':
+                number = strtol(optarg, &end_of_number, 10);
+                if(number < 1 || (*end_of_number && strcmp(end_of_number, "s"))) {
+                    (void) fprintf(stderr, "Invalid checkpoint interval: %s (operations or "
+                                   "seconds with s)\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                options.checkpoint_interval = number;
+                options.checkpoint_seconds = *end_of_number ? 1 : 0;
+                break;
+            case 'R':
+                (void) strncpy(options.resume_filename, optarg, MAX_FILE_NAME_LENGTH);
+                break;
+            case 'm':
+                errno = 0;
+                number = strtol(optarg, &end_of_number, 10);
+                if(*end_of_number || number < 1 || ERANGE == errno) {
+                    (void) fprintf(stderr, "Invalid step limit: %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                options.max_steps = number;
+                break;
+            case 'T':
+                seconds = strtod(optarg, &end_of_number);
+                if(*end_of_number || !(seconds >= 0.001 && seconds <= MAX_TIME_LIMIT)) {
+                    (void) fprintf(stderr, "Invalid time limit: %s (seconds, 0.001..%d)\n",
+                                   optarg, MAX_TIME_LIMIT);
+                    return EXIT_FAILURE;
+                }
+                options.max_time = (long) (seconds * 1000 + 0.5);
+                break;
+            case 'O':
+                errno = 0;
+                options.max_output = strtoul(optarg, &end_of_number, 10);
+                if(*end_of_number || !options.max_output || '-' == optarg[0] || ERANGE == errno) {
+                    (void) fprintf(stderr, "Invalid output limit: %s\n", optarg);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'P':
+                options.profile = 1;
+                break;
+            case 'S':
+                safe = 1;
+                break;
             case 's':
                 options.show_info = 1;
                 break;
@@ -1058,14 +7770,29 @@ int main(const int argc, char* const* argv) {
         print_preamble();
     }
 
-    read_config();
+    if(options.decode_trace_filename[0]) {
+        return decode_trace(options.decode_trace_filename) ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    if(options.config_filename[0]) {
+        (void) read_config_file(&options, options.config_filename);
+    }
+
+    /* The command line wins over the configuration file */
+    if(safe) {
+        options.use_safe_tape = 1;
+    }
+    if(cache) {
+        (void) strncpy(options.cache_directory, cache, MAX_FILE_NAME_LENGTH);
+    }
 
 	if(control()) {
 		return EXIT_FAILURE;
 	}
 
-	return work();
+	return options.batch_filename[0] ? batch() : work();
 }
+#endif /* !defined(BFPLUS_LIBRARY) */
 
 #if defined(__cplusplus)
 /*}*/
@@ -0,0 +1,726 @@
+/* ************************************************************************** */
+/* Program name: Brainfuck Interpreter Plus (bf+)                             */
+/* Description: Execution engine specialized for one cell type                */
+/* Author: Vasiliy V. Bodrov aka Bodro (e-mail: bodro-mail at list.ru)        */
+/* Date: 2014-09-08                                                           */
+/*                                                                            */
+/* Programming language: ISO/IEC 9899:1990 (C90)                              */
+/* Commenting language: English                                               */
+/* ************************************************************************** */
+/* This file is included by bf+.c once per cell type. Before inclusion:       */
+/*     ENGINE_CELL - cell type (e.g. unsigned char)                           */
+/*     ENGINE_SUFFIX - suffix of the function names (e.g. u8)                 */
+/* Both macros are undefined at the end of the file.                          */
+/* ************************************************************************** */
+/* Functions:                                                                 */
+/*     zero_cells_mask_<suffix>                                               */
+/*     scan_cells_<suffix>                                                    */
+/*     run_program_<suffix>                                                   */
+/*     run_program_threaded_<suffix>                                          */
+/*     sparse_cell_<suffix>                                                   */
+/*     run_program_sparse_<suffix>                                            */
+/*     jit_data_output_<suffix>                                               */
+/*     jit_data_input_<suffix>                                                */
+/* ************************************************************************** */
+/* The MIT License (MIT)                                                      */
+/*                                                                            */
+/* Copyright (c) 2014 IPB Software (Vasiliy V. Bodrov)                        */
+/*                                                                            */
+/* See the file bf+.c for the full license text.                              */
+/* ************************************************************************** */
+
+#if !defined(ENGINE_CELL) || !defined(ENGINE_SUFFIX)
+#error "ENGINE_CELL and ENGINE_SUFFIX must be defined"
+#endif /* !defined(ENGINE_CELL) || !defined(ENGINE_SUFFIX) */
+
+/* ************************************************************************** */
+/* PROTOTYPES                                                                 */
+/* ************************************************************************** */
+static unsigned int ENGINE_FUNCTION(zero_cells_mask)(const ENGINE_CELL* block);
+static void* ENGINE_FUNCTION(scan_cells)(void* cell, long stride);
+static int ENGINE_FUNCTION(run_program)(context_p context, const program_t* program, void* cells);
+static int ENGINE_FUNCTION(run_program_threaded)(context_p context, const program_t* program,
+                                                 void* cells);
+static ENGINE_CELL* ENGINE_FUNCTION(sparse_cell)(tape_p tape, long cell);
+static int ENGINE_FUNCTION(run_program_sparse)(context_p context, const program_t* program,
+                                               tape_p tape);
+static void ENGINE_FUNCTION(jit_data_output)(const jit_callbacks_t* callbacks, void* cell);
+static int ENGINE_FUNCTION(jit_data_input)(const jit_callbacks_t* callbacks, void* cell);
+
+/* ************************************************************************** */
+/* FUNCTIONS                                                                  */
+/* ************************************************************************** */
+
+/* -------------------------------------------------------------------------- */
+/* Function: zero_cells_mask_<suffix>                                         */
+/* Description: compares a block of SCAN_BLOCK_SIZE bytes with zero           */
+/* Parameters: block - block of cells (aligned to SCAN_BLOCK_SIZE)            */
+/* Return: bit i is set if byte i belongs to a zero cell                      */
+/* Note: SSE2 when available, otherwise cell by cell                          */
+/* -------------------------------------------------------------------------- */
+unsigned int ENGINE_FUNCTION(zero_cells_mask)(const ENGINE_CELL* block) {
+#if defined(__SSE2__)
+    __m128i data = _mm_load_si128((const __m128i*) block);
+    __m128i zero = _mm_setzero_si128();
+    __m128i result;
+
+    switch(sizeof(ENGINE_CELL)) {
+    case 1:
+        result = _mm_cmpeq_epi8(data, zero);
+        break;
+    case 2:
+        result = _mm_cmpeq_epi16(data, zero);
+        break;
+    case 4:
+        result = _mm_cmpeq_epi32(data, zero);
+        break;
+    default:
+        /* 64-bit cells: both halves must be zero */
+        result = _mm_cmpeq_epi32(data, zero);
+        result = _mm_and_si128(result, _mm_shuffle_epi32(result, 0xB1));
+        break;
+    }
+
+    return (unsigned int) _mm_movemask_epi8(result);
+#else
+    unsigned int mask = 0;
+    unsigned int i = 0;
+
+    for(i = 0; i < SCAN_BLOCK_SIZE / sizeof(ENGINE_CELL); i++) {
+        if(!block[i]) {
+            mask |= ((1U << sizeof(ENGINE_CELL)) - 1) << (i * sizeof(ENGINE_CELL));
+        }
+    }
+
+    return mask;
+#endif /* defined(__SSE2__) */
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: scan_cells_<suffix>                                              */
+/* Description: finds the next zero cell at the given stride                  */
+/* Parameters: cell - start cell                                              */
+/*             stride - distance between tested cells (negative: backward)    */
+/* Return: pointer to the zero cell                                           */
+/* Note: strides dividing the number of cells per block are tested a whole    */
+/*       aligned block at a time, other strides cell by cell                  */
+/* -------------------------------------------------------------------------- */
+void* ENGINE_FUNCTION(scan_cells)(void* cell, long stride) {
+    const long lanes = SCAN_BLOCK_SIZE / sizeof(ENGINE_CELL);
+    const long step = stride < 0 ? -stride : stride;
+    const unsigned int cell_bits = (1U << sizeof(ENGINE_CELL)) - 1;
+    unsigned int lane_mask = 0;
+    unsigned int mask = 0;
+    ENGINE_CELL* current_cell = (ENGINE_CELL*) cell;
+    ENGINE_CELL* block = NULL;
+    long position = 0;
+    long i = 0;
+
+    if(!*current_cell) {
+        return current_cell;
+    }
+
+    if(lanes % step) {
+        while(*current_cell) {
+            current_cell += stride;
+        }
+        return current_cell;
+    }
+
+    block = current_cell - ((unsigned long) current_cell % SCAN_BLOCK_SIZE) / sizeof(ENGINE_CELL);
+    position = current_cell - block;
+
+    /* Lanes with the same phase as the start cell (identical in every block) */
+    for(i = position % step; i < lanes; i += step) {
+        lane_mask |= cell_bits << (i * sizeof(ENGINE_CELL));
+    }
+
+    if(stride > 0) {
+        mask = ENGINE_FUNCTION(zero_cells_mask)(block) & lane_mask & (~0U << (position * sizeof(ENGINE_CELL)));
+        while(!mask) {
+            block += lanes;
+            mask = ENGINE_FUNCTION(zero_cells_mask)(block) & lane_mask;
+        }
+
+        for(i = 0; !(mask & (1U << i)); i++) {
+        }
+    }
+    else {
+        mask = ENGINE_FUNCTION(zero_cells_mask)(block) & lane_mask &
+               ((1U << ((position + 1) * sizeof(ENGINE_CELL))) - 1);
+        while(!mask) {
+            block -= lanes;
+            mask = ENGINE_FUNCTION(zero_cells_mask)(block) & lane_mask;
+        }
+
+        for(i = SCAN_BLOCK_SIZE - 1; !(mask & (1U << i)); i--) {
+        }
+    }
+
+    return block + i / (long) sizeof(ENGINE_CELL);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: run_program_<suffix>                                             */
+/* Description: executes the compiled program                                 */
+/* Parameters: context - context of the run                                   */
+/*             program - compiled program                                     */
+/*             cells - tape                                                   */
+/* Return: 0 - success; -1 - failure (procedure error or a limit)             */
+/* Note: control flow uses the precomputed bracket jumps only; a resumed run  */
+/*       starts where its snapshot was taken                                  */
+/* -------------------------------------------------------------------------- */
+int ENGINE_FUNCTION(run_program)(context_p context, const program_t* program, void* cells) {
+    const instruction_t* code = program->code;
+    ENGINE_CELL* current_cell = (ENGINE_CELL*) cells + context->checkpoint.cell;
+    const int verbose = context->options->verbose;
+    int trace = verbose || context->trace.events;
+    unsigned long* counts = context->profile_counts;
+    int checkpoints = context->checkpoint.interval > 0;
+    int instrumented = trace || counts || checkpoints;
+    int limits = context->steps > 0;
+    long steps = context->steps;
+    index_t pc = context->checkpoint.pc;
+    long cell = 0;
+    long offset = 0;
+    cell_t value = 0;
+
+    while(end_op != code[pc].op) {
+        /* A single test per operation when neither tracing nor profiling */
+        if(instrumented) {
+            if(trace) {
+                offset = trace_offset(&code[pc]);
+                trace_record(context, pc, &code[pc],
+                             (long) (current_cell - (ENGINE_CELL*) cells) + offset,
+                             (long) current_cell[offset]);
+            }
+            if(counts) {
+                counts[pc]++;
+            }
+#if defined(USE_POSIX_IO)
+            if(checkpoints) {
+                cell = (long) (current_cell - (ENGINE_CELL*) cells);
+                if(!--context->checkpoint.countdown) {
+                    checkpoint_tick(context, pc, cell);
+                }
+                checkpoint_touch(context, &code[pc], cell);
+            }
+#endif /* defined(USE_POSIX_IO) */
+        }
+
+        switch(code[pc].op) {
+        case cell_add_op:
+            current_cell[code[pc].offset] += code[pc].arg;
+            break;
+        case cell_move_op:
+            current_cell += code[pc].arg;
+            break;
+        case cell_clear_op:
+            current_cell[code[pc].offset] = 0;
+            break;
+        case cell_set_op:
+            current_cell[code[pc].offset] = (ENGINE_CELL) code[pc].arg;
+            break;
+        case cell_muladd_op:
+            current_cell[code[pc].offset] += *current_cell * code[pc].arg;
+            break;
+        case cell_scan_op:
+            current_cell = (ENGINE_CELL*) ENGINE_FUNCTION(scan_cells)(current_cell, code[pc].arg);
+            break;
+        case data_output_op:
+            if(verbose) {
+                output_write(context, "O> ", 3);
+            }
+
+            data_output(context, (cell_t) current_cell[code[pc].offset]);
+
+            if(verbose) {
+                output_write(context, "\n", 1);
+            }
+            break;
+        case data_write_op:
+            data_write(context, program, &code[pc]);
+            break;
+        case data_input_op:
+            if(verbose) {
+                output_write(context, "I> ", 3);
+            }
+
+            value = (cell_t) current_cell[code[pc].offset];
+            if(data_input(context, &value)) {
+                return limit_reached(context, steps);
+            }
+            current_cell[code[pc].offset] = (ENGINE_CELL) value;
+            break;
+        case loop_begin_op:
+            if(!*current_cell) {
+                pc = code[pc].jump;
+            }
+            else if(limits && LOOP_GUARD == code[pc].arg &&
+                    ((steps -= code[pc].jump - pc + 1) < 0 || context->limit)) {
+                /* A rewritten loop is charged as one pass */
+                return limit_reached(context, steps);
+            }
+            break;
+        case loop_end_op:
+            if(*current_cell) {
+                /* A back-edge is charged the length of the loop */
+                if(limits && ((steps -= pc - code[pc].jump + 1) < 0 || context->limit)) {
+                    return limit_reached(context, steps);
+                }
+                pc = code[pc].jump;
+            }
+            break;
+        case procedure_begin_op:
+            if(procedure_define(context, (cell_t) *current_cell, pc)) {
+                return -1;
+            }
+            pc = code[pc].jump;
+            break;
+        case procedure_end_op:
+            pc = context->calls[--context->call_depth];
+            break;
+        case procedure_call_op:
+        case procedure_direct_call_op:
+            pc = procedure_call(context, (cell_t) *current_cell,
+                                procedure_direct_call_op == code[pc].op ? code[pc].jump : -1, pc);
+            if(pc < 0) {
+                return -1;
+            }
+            break;
+        case cell_check_op:
+        case loop_check_op:
+            if(cell_check_op == code[pc].op || *current_cell) {
+                cell = (long) (current_cell - (ENGINE_CELL*) cells);
+                if(cell + code[pc].offset < 0 || cell + code[pc].arg >= STATIC_CELL_COUNT) {
+                    tape_error(cell, &code[pc]);
+                    return -1;
+                }
+            }
+            break;
+        default:
+            break;
+        }
+
+        ++pc;
+    }
+
+    context->steps = steps;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: run_program_threaded_<suffix>                                    */
+/* Description: executes the compiled program with direct threading           */
+/* Parameters: context - context of the run                                   */
+/*             program - compiled program                                     */
+/*             cells - tape                                                   */
+/* Return: 0 - success; -1 - failure                                          */
+/* Note: without GNU C (labels as values) the handlers are dispatched by a    */
+/*       switch; verbose mode is not supported                                */
+/* -------------------------------------------------------------------------- */
+int ENGINE_FUNCTION(run_program_threaded)(context_p context, const program_t* program,
+                                          void* cells) {
+#if defined(USE_COMPUTED_GOTO)
+    static const void* const handlers[] = {
+        &&handler_end_op,
+        &&handler_cell_add_op,
+        &&handler_cell_move_op,
+        &&handler_data_output_op,
+        &&handler_data_input_op,
+        &&handler_loop_begin_op,
+        &&handler_loop_end_op,
+        &&handler_cell_clear_op,
+        &&handler_cell_muladd_op,
+        &&handler_cell_scan_op,
+        &&handler_cell_set_op,
+        &&handler_data_write_op,
+        &&handler_procedure_begin_op,
+        &&handler_procedure_end_op,
+        &&handler_procedure_call_op,
+        &&handler_procedure_direct_call_op,
+        &&handler_cell_check_op,
+        &&handler_loop_check_op
+    };
+#define THREADED_CASE(op) handler_##op
+#define THREADED_DISPATCH() goto *ip->handler
+#else
+#define THREADED_CASE(op) case op
+#define THREADED_DISPATCH() continue
+#endif /* defined(USE_COMPUTED_GOTO) */
+    threaded_instruction_p code = NULL;
+    threaded_instruction_p ip = NULL;
+    ENGINE_CELL* current_cell = (ENGINE_CELL*) cells;
+    int limits = context->steps > 0;
+    long steps = context->steps;
+    index_t pc = 0;
+    long cell = 0;
+    cell_t value = 0;
+    int result = 0;
+
+    code = (threaded_instruction_p) malloc((size_t) program->size * sizeof(threaded_instruction_t));
+    if(!code) {
+        perror("Memory error");
+        return -1;
+    }
+
+    for(pc = 0; pc < program->size; pc++) {
+#if defined(USE_COMPUTED_GOTO)
+        code[pc].handler = handlers[program->code[pc].op];
+#else
+        code[pc].handler = NULL;
+#endif /* defined(USE_COMPUTED_GOTO) */
+        code[pc].op = program->code[pc].op;
+        code[pc].arg = program->code[pc].arg;
+        code[pc].offset = program->code[pc].offset;
+        code[pc].jump = code + program->code[pc].jump + 1;
+    }
+
+    ip = code;
+
+#if defined(USE_COMPUTED_GOTO)
+    THREADED_DISPATCH();
+    {
+#else
+    for(;;) {
+        switch(ip->op) {
+#endif /* defined(USE_COMPUTED_GOTO) */
+        THREADED_CASE(cell_add_op):
+            current_cell[ip->offset] += ip->arg;
+            ++ip;
+            THREADED_DISPATCH();
+        THREADED_CASE(cell_move_op):
+            current_cell += ip->arg;
+            ++ip;
+            THREADED_DISPATCH();
+        THREADED_CASE(data_output_op):
+            data_output(context, (cell_t) current_cell[ip->offset]);
+            ++ip;
+            THREADED_DISPATCH();
+        THREADED_CASE(data_input_op):
+            value = (cell_t) current_cell[ip->offset];
+            if(data_input(context, &value)) {
+                result = limit_reached(context, steps);
+                goto done;
+            }
+            current_cell[ip->offset] = (ENGINE_CELL) value;
+            ++ip;
+            THREADED_DISPATCH();
+        THREADED_CASE(loop_begin_op):
+            if(limits && *current_cell && LOOP_GUARD == ip->arg &&
+               ((steps -= (long) (ip->jump - ip)) < 0 || context->limit)) {
+                result = limit_reached(context, steps);
+                goto done;
+            }
+            ip = *current_cell ? ip + 1 : ip->jump;
+            THREADED_DISPATCH();
+        THREADED_CASE(loop_end_op):
+            if(limits && *current_cell &&
+               ((steps -= (long) (ip - ip->jump) + 2) < 0 || context->limit)) {
+                result = limit_reached(context, steps);
+                goto done;
+            }
+            ip = *current_cell ? ip->jump : ip + 1;
+            THREADED_DISPATCH();
+        THREADED_CASE(cell_clear_op):
+            current_cell[ip->offset] = 0;
+            ++ip;
+            THREADED_DISPATCH();
+        THREADED_CASE(cell_muladd_op):
+            current_cell[ip->offset] += *current_cell * ip->arg;
+            ++ip;
+            THREADED_DISPATCH();
+        THREADED_CASE(cell_scan_op):
+            current_cell = (ENGINE_CELL*) ENGINE_FUNCTION(scan_cells)(current_cell, ip->arg);
+            ++ip;
+            THREADED_DISPATCH();
+        THREADED_CASE(cell_set_op):
+            current_cell[ip->offset] = (ENGINE_CELL) ip->arg;
+            ++ip;
+            THREADED_DISPATCH();
+        THREADED_CASE(data_write_op):
+            output_write(context, program->data + ip->offset, (size_t) ip->arg);
+            ++ip;
+            THREADED_DISPATCH();
+        THREADED_CASE(procedure_begin_op):
+            if(procedure_define(context, (cell_t) *current_cell, (index_t) (ip - code))) {
+                result = -1;
+                goto done;
+            }
+            ip = ip->jump;
+            THREADED_DISPATCH();
+        THREADED_CASE(procedure_end_op):
+            ip = code + context->calls[--context->call_depth] + 1;
+            THREADED_DISPATCH();
+        THREADED_CASE(procedure_call_op):
+            pc = procedure_call(context, (cell_t) *current_cell, -1, (index_t) (ip - code));
+            if(pc < 0) {
+                result = -1;
+                goto done;
+            }
+            ip = code + pc + 1;
+            THREADED_DISPATCH();
+        THREADED_CASE(procedure_direct_call_op):
+            if(procedure_call(context, 0, (index_t) (ip->jump - code) - 1,
+                              (index_t) (ip - code)) < 0) {
+                result = -1;
+                goto done;
+            }
+            ip = ip->jump;
+            THREADED_DISPATCH();
+        THREADED_CASE(cell_check_op):
+        THREADED_CASE(loop_check_op):
+            if(cell_check_op == ip->op || *current_cell) {
+                cell = (long) (current_cell - (ENGINE_CELL*) cells);
+                if(cell + ip->offset < 0 || cell + ip->arg >= STATIC_CELL_COUNT) {
+                    tape_error(cell, &program->code[ip - code]);
+                    result = -1;
+                    goto done;
+                }
+            }
+            ++ip;
+            THREADED_DISPATCH();
+        THREADED_CASE(end_op):
+            context->steps = steps;
+            goto done;
+#if !defined(USE_COMPUTED_GOTO)
+        }
+#endif /* !defined(USE_COMPUTED_GOTO) */
+    }
+
+done:
+#undef THREADED_CASE
+#undef THREADED_DISPATCH
+
+    free(code);
+
+    return result;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: sparse_cell_<suffix>                                             */
+/* Description: finds a cell of the sparse tape                               */
+/* Parameters: tape - sparse tape                                             */
+/*             cell - index of the cell (any long)                            */
+/* Return: cell or NULL (no memory)                                           */
+/* Note: the page of the previous lookup is checked before the directory      */
+/* -------------------------------------------------------------------------- */
+ENGINE_CELL* ENGINE_FUNCTION(sparse_cell)(tape_p tape, long cell) {
+    unsigned long index = (unsigned long) cell;
+    ENGINE_CELL* page = (ENGINE_CELL*) tape->last_page;
+
+    if(!page || tape->last_number != index >> SPARSE_PAGE_BITS) {
+        page = (ENGINE_CELL*) sparse_page(tape, index >> SPARSE_PAGE_BITS);
+        if(!page) {
+            return NULL;
+        }
+    }
+
+    return page + (index & (SPARSE_PAGE_CELLS - 1));
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: run_program_sparse_<suffix>                                      */
+/* Description: executes the compiled program on a sparse tape                */
+/* Parameters: context - context of the run                                   */
+/*             program - compiled program                                     */
+/*             tape - sparse tape                                             */
+/* Return: 0 - success; -1 - failure (procedure or memory error, a limit)     */
+/* Note: as run_program_<suffix>, with the current cell kept as an index;     */
+/*       used for every engine, tracing and profiling on a sparse tape        */
+/* -------------------------------------------------------------------------- */
+int ENGINE_FUNCTION(run_program_sparse)(context_p context, const program_t* program,
+                                        tape_p tape) {
+    const instruction_t* code = program->code;
+    const int verbose = context->options->verbose;
+    int trace = verbose || context->trace.events;
+    unsigned long* counts = context->profile_counts;
+    int checkpoints = context->checkpoint.interval > 0;
+    int instrumented = trace || counts || checkpoints;
+    int limits = context->steps > 0;
+    long steps = context->steps;
+    ENGINE_CELL* current_cell = NULL;
+    ENGINE_CELL* target = NULL;
+    long cell = context->checkpoint.cell;
+    long offset = 0;
+    index_t pc = context->checkpoint.pc;
+    cell_t value = 0;
+
+    while(end_op != code[pc].op) {
+        if(instrumented) {
+            if(trace) {
+                offset = trace_offset(&code[pc]);
+                current_cell = ENGINE_FUNCTION(sparse_cell)(tape, cell + offset);
+                if(!current_cell) {
+                    return -1;
+                }
+                trace_record(context, pc, &code[pc], cell + offset, (long) *current_cell);
+            }
+            if(counts) {
+                counts[pc]++;
+            }
+#if defined(USE_POSIX_IO)
+            if(checkpoints && !--context->checkpoint.countdown) {
+                checkpoint_tick(context, pc, cell);
+            }
+#endif /* defined(USE_POSIX_IO) */
+        }
+
+        /* Instructions that use no cell */
+        switch(code[pc].op) {
+        case cell_move_op:
+            cell += code[pc].arg;
+            ++pc;
+            continue;
+        case data_write_op:
+            data_write(context, program, &code[pc]);
+            ++pc;
+            continue;
+        case procedure_end_op:
+            pc = context->calls[--context->call_depth] + 1;
+            continue;
+        case cell_check_op:
+        case loop_check_op:
+            /* The sparse tape has no bounds */
+            ++pc;
+            continue;
+        default:
+            break;
+        }
+
+        target = ENGINE_FUNCTION(sparse_cell)(tape, cell + code[pc].offset);
+        if(!target) {
+            return -1;
+        }
+
+        switch(code[pc].op) {
+        case cell_add_op:
+            *target += code[pc].arg;
+            break;
+        case cell_clear_op:
+            *target = 0;
+            break;
+        case cell_set_op:
+            *target = (ENGINE_CELL) code[pc].arg;
+            break;
+        case cell_muladd_op:
+            current_cell = ENGINE_FUNCTION(sparse_cell)(tape, cell);
+            if(!current_cell) {
+                return -1;
+            }
+            *target += *current_cell * code[pc].arg;
+            break;
+        case cell_scan_op:
+            while(*target) {
+                cell += code[pc].arg;
+                target = ENGINE_FUNCTION(sparse_cell)(tape, cell);
+                if(!target) {
+                    return -1;
+                }
+            }
+            break;
+        case data_output_op:
+            if(verbose) {
+                output_write(context, "O> ", 3);
+            }
+
+            data_output(context, (cell_t) *target);
+
+            if(verbose) {
+                output_write(context, "\n", 1);
+            }
+            break;
+        case data_input_op:
+            if(verbose) {
+                output_write(context, "I> ", 3);
+            }
+
+            value = (cell_t) *target;
+            if(data_input(context, &value)) {
+                return limit_reached(context, steps);
+            }
+            *target = (ENGINE_CELL) value;
+            break;
+        case loop_begin_op:
+            if(!*target) {
+                pc = code[pc].jump;
+            }
+            else if(limits && LOOP_GUARD == code[pc].arg &&
+                    ((steps -= code[pc].jump - pc + 1) < 0 || context->limit)) {
+                return limit_reached(context, steps);
+            }
+            break;
+        case loop_end_op:
+            if(*target) {
+                if(limits && ((steps -= pc - code[pc].jump + 1) < 0 || context->limit)) {
+                    return limit_reached(context, steps);
+                }
+                pc = code[pc].jump;
+            }
+            break;
+        case procedure_begin_op:
+            if(procedure_define(context, (cell_t) *target, pc)) {
+                return -1;
+            }
+            pc = code[pc].jump;
+            break;
+        case procedure_call_op:
+        case procedure_direct_call_op:
+            pc = procedure_call(context, (cell_t) *target,
+                                procedure_direct_call_op == code[pc].op ? code[pc].jump : -1, pc);
+            if(pc < 0) {
+                return -1;
+            }
+            break;
+        default:
+            break;
+        }
+
+        ++pc;
+    }
+
+    context->steps = steps;
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: jit_data_output_<suffix>                                         */
+/* Description: output callback of the native code                            */
+/* Parameters: callbacks - callback table (holds the context)                 */
+/*             cell - current cell                                            */
+/* Return: */
+/* Note: */
+/* -------------------------------------------------------------------------- */
+void ENGINE_FUNCTION(jit_data_output)(const jit_callbacks_t* callbacks, void* cell) {
+    data_output(callbacks->context, (cell_t) *(ENGINE_CELL*) cell);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Function: jit_data_input_<suffix>                                          */
+/* Description: input callback of the native code                             */
+/* Parameters: callbacks - callback table (holds the context)                 */
+/*             cell - current cell                                            */
+/* Return: 0 - success; -1 - a limit cut the read short                       */
+/* Note: the native code returns after a failure                              */
+/* -------------------------------------------------------------------------- */
+int ENGINE_FUNCTION(jit_data_input)(const jit_callbacks_t* callbacks, void* cell) {
+    cell_t value = (cell_t) *(ENGINE_CELL*) cell;
+
+    if(data_input(callbacks->context, &value)) {
+        (void) limit_reached(callbacks->context, callbacks->steps);
+        callbacks->context->jit_result = -1;
+        return -1;
+    }
+    *(ENGINE_CELL*) cell = (ENGINE_CELL) value;
+
+    return 0;
+}
+
+#undef ENGINE_CELL
+#undef ENGINE_SUFFIX
+
+/* ************************************************************************** */
+/* End of file                                                                */
+/* ************************************************************************** */
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/* Program name: Brainfuck Interpreter Plus (bf+)                             */
+/* Description: Embedding interface (libbfplus)                               */
+/* Author: Vasiliy V. Bodrov aka Bodro (e-mail: bodro-mail at list.ru)        */
+/* Date: 2014-09-08                                                           */
+/*                                                                            */
+/* Programming language: ISO/IEC 9899:1990 (C90)                              */
+/* Commenting language: English                                               */
+/* ************************************************************************** */
+/* The library is bf+.c built with BFPLUS_LIBRARY defined (see build.sh).     */
+/*                                                                            */
+/* A program is compiled once from its source and the options of the          */
+/* language and is never changed afterwards, so any number of virtual         */
+/* machines (VM) may run it at the same time, one thread per VM. A VM owns    */
+/* the tape and the input and output state of a run and is reused from run    */
+/* to run: the tape is cleared, not reallocated.                              */
+/*                                                                            */
+/*     bfplus_options_t* options = bfplus_create_options();                   */
+/*     bfplus_program_t* program = bfplus_compile(options, source, size);     */
+/*     bfplus_vm_t* vm = bfplus_create_vm();                                  */
+/*                                                                            */
+/*     bfplus_set_buffers(vm, input, input_size, output, sizeof(output));     */
+/*     if(!bfplus_run(vm, program)) {                                         */
+/*         ... bfplus_output_size(vm) bytes of output ...                     */
+/*     }                                                                      */
+/*                                                                            */
+/*     bfplus_destroy_vm(vm);                                                 */
+/*     bfplus_destroy_program(program);                                       */
+/*     bfplus_destroy_options(options);                                       */
+/*                                                                            */
+/* Errors are reported with the return value; a message is printed to the     */
+/* standard error as by the interpreter.                                      */
+/* ************************************************************************** */
+/* Functions:                                                                 */
+/*     bfplus_create_options                                                  */
+/*     bfplus_set_option                                                      */
+/*     bfplus_read_config                                                     */
+/*     bfplus_destroy_options                                                 */
+/*     bfplus_compile                                                         */
+/*     bfplus_compile_file                                                    */
+/*     bfplus_destroy_program                                                 */
+/*     bfplus_create_vm                                                       */
+/*     bfplus_set_callbacks                                                   */
+/*     bfplus_set_buffers                                                     */
+/*     bfplus_set_files                                                       */
+/*     bfplus_run                                                             */
+/*     bfplus_output_size                                                     */
+/*     bfplus_destroy_vm                                                      */
+/* ************************************************************************** */
+/* The MIT License (MIT)                                                      */
+/*                                                                            */
+/* Copyright (c) 2014 IPB Software (Vasiliy V. Bodrov)                        */
+/*                                                                            */
+/* See the file bf+.c for the full license text.                              */
+/* ************************************************************************** */
+
+#if !defined(BFPLUS_H)
+#define BFPLUS_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/* ************************************************************************** */
+/* USER TYPES                                                                 */
+/* ************************************************************************** */
+
+/* Options of the language and of the engine (opaque) */
+typedef struct program_options_s bfplus_options_t;
+
+/* Compiled program (opaque, immutable) */
+typedef struct bfplus_program_s bfplus_program_t;
+
+/* Virtual machine: tape, input and output of a run (opaque) */
+typedef struct bfplus_vm_s bfplus_vm_t;
+
+/* Reads up to size bytes of input: count of bytes, 0 - end, -1 - error */
+typedef long (*bfplus_read_t)(void* user, unsigned char* data, unsigned long size);
+
+/* Writes size bytes of output: 0 - success, -1 - error (the run fails) */
+typedef int (*bfplus_write_t)(void* user, const unsigned char* data, unsigned long size);
+
+/* ************************************************************************** */
+/* PROTOTYPES                                                                 */
+/* ************************************************************************** */
+
+/* Default options (those of bf+ without a configuration file) or NULL */
+bfplus_options_t* bfplus_create_options(void);
+
+/* Sets an option by its bf+.conf name; "engine" is switch, threaded or jit;  */
+/* 0 - success, -1 - unknown name                                             */
+int bfplus_set_option(bfplus_options_t* options, const char* name, const char* value);
+
+/* Reads a configuration file (bf+.conf format): 0 - success, -1 - failure    */
+int bfplus_read_config(bfplus_options_t* options, const char* filename);
+
+void bfplus_destroy_options(bfplus_options_t* options);
+
+/* Compiles and optimizes a source text; the options are copied; NULL on      */
+/* error                                                                      */
+bfplus_program_t* bfplus_compile(const bfplus_options_t* options,
+                                 const char* source, unsigned long size);
+
+/* Compiles a source file; NULL on error */
+bfplus_program_t* bfplus_compile_file(const bfplus_options_t* options, const char* filename);
+
+void bfplus_destroy_program(bfplus_program_t* program);
+
+/* New VM reading the standard input and writing the standard output or NULL */
+bfplus_vm_t* bfplus_create_vm(void);
+
+/* Input and output through callbacks (NULL - the file or standard stream)    */
+void bfplus_set_callbacks(bfplus_vm_t* vm, bfplus_read_t read, bfplus_write_t write,
+                          void* user);
+
+/* Input and output in memory: the input is not copied and must live until    */
+/* the end of the run; output beyond output_capacity fails the run; a buffer  */
+/* takes precedence over the callback and the file (NULL - not used)          */
+void bfplus_set_buffers(bfplus_vm_t* vm, const void* input, unsigned long input_size,
+                        void* output, unsigned long output_capacity);
+
+/* Input and output files ("" or NULL - the standard stream; names copied)    */
+void bfplus_set_files(bfplus_vm_t* vm, const char* input_filename,
+                      const char* output_filename);
+
+/* Runs the program from a cleared tape: 0 - success, -1 - failure */
+int bfplus_run(bfplus_vm_t* vm, const bfplus_program_t* program);
+
+/* Bytes written to the output buffer by the last run */
+unsigned long bfplus_output_size(const bfplus_vm_t* vm);
+
+void bfplus_destroy_vm(bfplus_vm_t* vm);
+
+#if defined(__cplusplus)
+}
+#endif /* defined(__cplusplus) */
+
+#endif /* !defined(BFPLUS_H) */
+
+/* ************************************************************************** */
+/* End of file                                                                */
+/* ************************************************************************** */
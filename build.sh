@@ -2,4 +2,9 @@
 
 rm -f bf
 
-gcc -std=c89 -Wall -Wextra -pedantic -gdwarf-4 bf+.c -o bf+ && echo "OK" || echo "ERROR"
+# Interpreter and the embedding library (libbfplus.a, interface in bfplus.h)
+gcc -std=c89 -Wall -Wextra -pedantic -gdwarf-4 -pthread bf+.c -o bf+ &&
+gcc -std=c89 -Wall -Wextra -pedantic -gdwarf-4 -pthread -DBFPLUS_LIBRARY -c bf+.c -o libbfplus.o &&
+ar rcs libbfplus.a libbfplus.o && echo "OK" || echo "ERROR"
+
+rm -f libbfplus.o
@@ -0,0 +1,56 @@
+#! /bin/sh
+
+# Regression cases of the safe tape (--safe) for bf+
+#
+# Usage: tests/safe_tape.sh [-b binary]
+#
+#   -b  interpreter to test (default ./bf+ next to this directory)
+#
+# Each case is run with every engine (switch, threaded, jit) and with
+# --profile. A copy or multiply loop whose cell is zero must not touch its
+# target cells, so it must not stop the program at the edge of the tape;
+# the same loop with a non-zero cell must. One line per failed case goes to
+# the standard error; the exit status is the count of failures.
+
+dir=$(cd "$(dirname "$0")" && pwd)
+binary="$dir/../bf+"
+
+while getopts "b:" option; do
+    case $option in
+    b) binary=$OPTARG ;;
+    *) exit 1 ;;
+    esac
+done
+
+program="${TMPDIR:-/tmp}/bf+-safe-tape.$$.b"
+trap 'rm -f "$program"' EXIT INT TERM
+
+failures=0
+
+# check expected_status program_text
+check() {
+    printf '%s' "$2" > "$program"
+    for engine_option in "-e switch" "-e threaded" "-j" "-P"; do
+        "$binary" -q -S $engine_option -f "$program" >/dev/null 2>&1
+        status=$?
+        if [ "$status" -ne "$1" ]; then
+            echo "failed: $engine_option, status $status (expected $1): $2" | cut -c1-100 >&2
+            failures=$((failures + 1))
+        fi
+    done
+}
+
+edge=$(printf '%2046s' '' | tr ' ' '>')
+
+# Zero loop cell: the targets are not used
+check 0 '[-<<+>>]+++'
+check 0 '[-<->]'
+check 0 '[-<<<->>>]'
+check 0 "$edge[->>+<<]"
+check 0 '>>[-]<<[-<<+>>]'
+
+# Non-zero loop cell: the targets are outside the tape
+check 1 '+[-<<+>>]'
+check 1 "$edge+[->>+<<]"
+
+exit $failures